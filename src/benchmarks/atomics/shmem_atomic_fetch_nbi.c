@@ -6,75 +6,43 @@
 
 #include "shmem_atomic_fetch_nbi.h"
 
+#if defined(USE_15)
 /**
-  @brief Run the latency benchmark for shmem_atomic_fetch_nbi
-  @param ntimes Number of iterations for the benchmark
+  @brief Issue one shmem_atomic_fetch_nbi on a random PE
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
  */
-void bench_shmem_atomic_fetch_nbi_latency(int ntimes) {
-#if defined(USE_15)
-  /* Check the number of PEs before doing anything */
-  if (!check_if_atleast_2_pes()) {
-    return;
-  }
-
-  /* Allocate memory for the destination, source, and timing variables */
-  int npes = shmem_n_pes();
-  long *dest = (long *)shmem_malloc(npes * sizeof(long));
-  long *source = (long *)shmem_malloc(sizeof(long));
-  double *local_total_time = (double *)shmem_malloc(sizeof(double));
-  double *total_time = (double *)shmem_malloc(sizeof(double));
-
-  /* Check for successful memory allocation */
-  if (!dest || !source || !local_total_time || !total_time) {
-    if (shmem_my_pe() == 0) {
-      fprintf(stderr, "PE %d: shmem_malloc failed\n", shmem_my_pe());
-    }
-    shmem_global_exit(1);
-  }
-
-  *local_total_time = 0.0;
-  *total_time = 0.0;
-
-  /* Sync PEs */
-  shmem_barrier_all();
-
-  /* Perform the shmem_atomic_fetch_nbi operation ntimes and measure latency */
-  for (int i = 0; i < ntimes; i++) {
-    int pe = rand() % npes; /* Randomly select a target PE */
-    double start_time = mysecond();
-
-    /* Perform atomic fetch non-blocking */
-    shmem_atomic_fetch_nbi(source, &dest[shmem_my_pe()], pe);
-
-    /* Ensure completion */
-    shmem_quiet();
-
-    double end_time = mysecond();
-    *local_total_time +=
-        (end_time - start_time) * 1e6; /* Convert to microseconds */
-  }
-
-  /* Aggregate and display results */
-  shmem_double_sum_reduce(SHMEM_TEAM_WORLD, total_time, local_total_time, 1);
-
-  if (shmem_my_pe() == 0) {
-    display_atomic_latency_results("shmem_atomic_fetch_nbi", *total_time / npes,
-                                   ntimes);
-  }
-
-  shmem_barrier_all();
-
-  /* Free memory */
-  shmem_free(dest);
-  shmem_free(source);
-  shmem_free(local_total_time);
-  shmem_free(total_time);
-
+static inline void shmem_atomic_fetch_nbi_issue(bench_ctx_t *ctx, int j) {
+  long *dest = (long *)ctx->dest;
+  long *source = (long *)ctx->source;
+  shmem_atomic_fetch_nbi(&source[ctx->mype], &dest[ctx->mype],
+                         bench_target(ctx, j));
+}
 #else
-  if (shmem_my_pe() == 0) {
-    fprintf(
-        stderr,
-        "shmem_atomic_fetch_nbi is not supported by this OpenSHMEM version!\n");
-  }
+/* Not provided by OpenSHMEM 1.4 */
+#define shmem_atomic_fetch_nbi_issue NULL
 #endif
-}
+
+/* Every PE targets random PEs, completing each operation */
+BENCH_DEFINE_OP(bench_shmem_atomic_fetch_nbi_latency,
+                .benchmark = "shmem_atomic_fetch_nbi",
+                .benchtype = "latency",
+                .pes = BENCH_ATLEAST_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .complete_at = BENCH_COMPLETE_EACH,
+                .op_name = "Operation",
+                .prepare = bench_prepare_scalars,
+                .issue = shmem_atomic_fetch_nbi_issue);
+
+/* Every PE targets random PEs, computing between issue and shmem_quiet of
+   every operation for as long as the operation alone takes */
+BENCH_DEFINE_OP(bench_shmem_atomic_fetch_nbi_overlap,
+                .benchmark = "shmem_atomic_fetch_nbi",
+                .benchtype = "overlap",
+                .pes = BENCH_ATLEAST_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .complete_at = BENCH_COMPLETE_EACH,
+                .overlap = true,
+                .op_name = "Operation",
+                .prepare = bench_prepare_scalars,
+                .issue = shmem_atomic_fetch_nbi_issue);
@@ -8,17 +8,22 @@
 #define SHMEM_ATOMIC_FETCH_NBI_H
 
 #include <shmem.h>
-#include <stdlib.h>
-#include <stdio.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "shmembench.h"
 
 /**
-  @brief Run the latency benchmark for shmem_atomic_fetch_nbi
-  @param ntimes Number of iterations for the benchmark
+  @brief Latency benchmark for shmem_atomic_fetch_nbi
+ */
+extern const bench_op_t bench_shmem_atomic_fetch_nbi_latency;
+
+/**
+  @brief Communication/computation overlap benchmark for
+  shmem_atomic_fetch_nbi
  */
-void bench_shmem_atomic_fetch_nbi_latency(int ntimes);
+extern const bench_op_t bench_shmem_atomic_fetch_nbi_overlap;
 
 #endif /* SHMEM_ATOMIC_FETCH_NBI_H */
@@ -8,17 +8,16 @@
 #define SHMEM_ATOMIC_SWAP_H
 
 #include <shmem.h>
-#include <stdlib.h>
-#include <stdio.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "shmembench.h"
 
 /**
-  @brief Run the latency benchmark for shmem_atomic_swap
-  @param ntimes Number of iterations for the benchmark
+  @brief Latency benchmark for shmem_atomic_swap
  */
-void bench_shmem_atomic_swap_latency(int ntimes);
+extern const bench_op_t bench_shmem_atomic_swap_latency;
 
 #endif /* SHMEM_ATOMIC_SWAP_H */
@@ -7,19 +7,16 @@
 #define SHMEM_ALLTOALL_H
 
 #include <shmem.h>
-#include <stdlib.h>
-#include <stdio.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_alltoall
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of iterations for the benchmark
+  @brief Bandwidth benchmark for shmem_alltoall
  */
-void bench_shmem_alltoall_bw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_alltoall_bw;
 
 #endif /* SHMEM_ALLTOALL_H */
@@ -7,17 +7,16 @@
 #define SHMEM_BARRIER_ALL_H
 
 #include <shmem.h>
-#include <stdlib.h>
-#include <stdio.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "shmembench.h"
 
 /**
-  @brief Run the latency benchmark for shmem_barrier_all
-  @param ntimes Number of times to repeat the operation
+  @brief Latency benchmark for shmem_barrier_all
  */
-void bench_shmem_barrier_all_latency(int ntimes);
+extern const bench_op_t bench_shmem_barrier_all_latency;
 
 #endif /* SHMEM_BARRIER_ALL_H */
@@ -8,19 +8,16 @@
 #define SHMEM_BROADCAST_H
 
 #include <shmem.h>
-#include <stdlib.h>
-#include <stdio.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_broadcast
-  @param min_msg_size Minimum message size for the test in bytes
-  @param max_msg_size Maximum message size for the test in bytes
-  @param ntimes Number of times to run the benchmark
+  @brief Bandwidth benchmark for shmem_broadcast
  */
-void bench_shmem_broadcast_bw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_broadcast_bw;
 
 #endif /* SHMEM_BROADCAST_H */
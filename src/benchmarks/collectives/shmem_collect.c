@@ -7,102 +7,39 @@
 #include "shmem_collect.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_collect
-  @param min_msg_size Minimum message size for the test in bytes
-  @param max_msg_size Maximum message size for the test in bytes
-  @param ntimes Number of times to run the benchmark
+  @brief Get buffers with room for the blocks gathered from every PE
+  @param ctx Benchmark state
  */
-void bench_shmem_collect_bw(int min_msg_size, int max_msg_size, int ntimes) {
-  /* Ensure there are at least 2 PEs available to run the benchmark */
-  if (!check_if_atleast_2_pes()) {
-    return;
-  }
-
-  /* Variables for message sizes, times, and bandwidths */
-  int *msg_sizes;
-  double *times, *bandwidths;
-  int num_sizes = 0;
-
-  /* Setup benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &bandwidths);
-
-  /* Get the number of processing elements (PEs) and PE number */
-  int npes = shmem_n_pes();
-
-#if defined(USE_14)
-  /* Setup pSync array */
-  long *pSync = (long *)shmem_malloc(SHMEM_COLLECT_SYNC_SIZE * sizeof(long));
-  for (int i = 0; i < SHMEM_COLLECT_SYNC_SIZE; i++) {
-    pSync[i] = SHMEM_SYNC_VALUE;
-  }
-  shmem_barrier_all();
-#endif
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
-
-    /* Allocate memory for source and destination arrays */
-    long *source = (long *)shmem_malloc(elem_count * sizeof(long));
-    long *dest = (long *)shmem_malloc(npes * elem_count * sizeof(long));
-
-    /* Initialize the source buffer with data */
-    for (int j = 0; j < elem_count; j++) {
-      source[j] = j;
-    }
-
-    double start_time, end_time;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Start timer */
-    start_time = mysecond();
+static void shmem_collect_prepare(bench_ctx_t *ctx) {
+  bench_prepare_buffers(ctx, ctx->msg_size * ctx->npes,
+                        ctx->max_msg_size * ctx->npes);
+}
 
-    /* Perform the shmem_collect operation for the specified number of times */
-    for (int j = 0; j < ntimes; j++) {
+/**
+  @brief Issue one shmem_collect of msg_size bytes of longs
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_collect_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
 #if defined(USE_14)
-      shmem_collect64(dest, source, elem_count, 0, 0, npes, pSync);
+  shmem_collect64(ctx->dest, ctx->source, ctx->elem_count, 0, 0,
+                  ctx->npes, ctx->psync);
 #elif defined(USE_15)
-      shmem_collect(SHMEM_TEAM_WORLD, dest, source, elem_count);
-#endif
-    }
-    shmem_quiet();
-    
-    /* Stop timer */
-    end_time = mysecond();
-
-    /* Calculate average time per operation in useconds */
-    times[i] = (end_time - start_time) * 1e6 / ntimes;
-
-    /* Calculate bandwidth*/
-    bandwidths[i] = calculate_bw(valid_size, times[i]);
-
-    /* Free the allocated memory for source and destination arrays */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (shmem_my_pe() == 0) {
-    display_results(times, msg_sizes, bandwidths, "bw", num_sizes);
-  }
-  shmem_barrier_all();
-
-#if defined(USE_14)
-  /* Free pSync allocated for OpenSHMEM 1.4 path */
-  shmem_free(pSync);
+  shmem_collect(SHMEM_TEAM_WORLD, (long *)ctx->dest,
+                (const long *)ctx->source, ctx->elem_count);
 #endif
-
-  /* Free the memory allocated for message sizes, times, and bandwidths */
-  free(msg_sizes);
-  free(times);
-  free(bandwidths);
 }
+
+/* Every PE takes part in each shmem_collect */
+BENCH_DEFINE_OP(bench_shmem_collect_bw,
+                .benchmark = "shmem_collect",
+                .benchtype = "bw",
+                .pes = BENCH_ATLEAST_2_PES,
+                .issuers = BENCH_ISSUE_COLLECTIVE,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .psync_size = BENCH_PSYNC(SHMEM_COLLECT_SYNC_SIZE),
+                .prepare = shmem_collect_prepare,
+                .issue = shmem_collect_issue);
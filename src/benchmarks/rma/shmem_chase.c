@@ -0,0 +1,178 @@
+/**
+  @file shmem_chase.c
+  @brief Source file for the pointer-chasing get latency benchmarks with
+  support for OpenSHMEM 1.4 and 1.5
+  PE 0 walks one random cycle through the nodes of a symmetric array spread
+  over all other PEs. Every get returns the PE and node of the next, so no
+  load can start before the previous one is back; the message size is the
+  working set on each PE.
+*/
+
+#include "shmem_chase.h"
+
+/* Link of the chain to node `node` of PE `pe` */
+#define SHMEM_CHASE_LINK(pe, node)                                             \
+  (((long)(pe) << BENCH_CHASE_PE_SHIFT) | (long)(node))
+
+/**
+  @brief Step a xorshift64 generator; rand() has too few bits to shuffle
+  chains of billions of nodes
+  @param state Generator state (not 0)
+  @return Next pseudo-random number
+ */
+static inline uint64_t shmem_chase_random(uint64_t *state) {
+  uint64_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  *state = x;
+  return x;
+}
+
+/**
+  @brief Link every node of every PE but PE 0 into one random cycle and
+  write each PE's part of it (on PE 0)
+  @param ctx Benchmark state; source holds one PE's part at a time
+ */
+static void shmem_chase_build(bench_ctx_t *ctx) {
+  size_t nodes = ctx->elem_count;
+  size_t total = nodes * (size_t)(ctx->npes - 1);
+  long *next = (long *)malloc(total * sizeof(long));
+  if (next == NULL) {
+    fprintf(stderr, "PE %d: Unable to allocate a chain of %zu nodes\n",
+            ctx->mype, total);
+    shmem_global_exit(1);
+  }
+
+  /* Sattolo's algorithm: a uniformly random permutation of one cycle, so
+     the walk visits every node before it repeats */
+  for (size_t g = 0; g < total; g++) {
+    next[g] = (long)g;
+  }
+  uint64_t state = 0x9e3779b97f4a7c15ULL;
+  for (size_t g = total - 1; g > 0; g--) {
+    size_t k = (size_t)(shmem_chase_random(&state) % g);
+    long swap = next[g];
+    next[g] = next[k];
+    next[k] = swap;
+  }
+
+  /* Global node g is node g % nodes of PE g / nodes + 1 */
+  size_t stride = BENCH_CHASE_NODE / sizeof(long);
+  long *part = (long *)ctx->source;
+  for (int pe = 1; pe < ctx->npes; pe++) {
+    const long *from = &next[(size_t)(pe - 1) * nodes];
+    for (size_t i = 0; i < nodes; i++) {
+      size_t g = (size_t)from[i];
+      part[i * stride] = SHMEM_CHASE_LINK(g / nodes + 1, g % nodes);
+    }
+#if defined(USE_14) || defined(USE_15)
+    shmem_putmem(ctx->dest, ctx->source, ctx->msg_size, pe);
+    shmem_quiet();
+#endif
+  }
+  free(next);
+}
+
+/**
+  @brief Follow one link of the chain with shmem_long_g
+  @param ctx Benchmark state prepared by shmem_chase_prepare
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_g_chase_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  const long *chain = (const long *)ctx->dest;
+  long link = ctx->chase;
+  size_t node = (size_t)(link & ((1L << BENCH_CHASE_PE_SHIFT) - 1));
+  int pe = (int)(link >> BENCH_CHASE_PE_SHIFT);
+  ctx->chase = shmem_long_g(chain + node * (BENCH_CHASE_NODE / sizeof(long)),
+                            pe);
+#endif
+}
+
+/**
+  @brief Follow one link of the chain with a shmem_getmem of the whole
+  node into source
+  @param ctx Benchmark state prepared by shmem_chase_prepare
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_getmem_chase_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  const char *chain = (const char *)ctx->dest;
+  long link = ctx->chase;
+  size_t node = (size_t)(link & ((1L << BENCH_CHASE_PE_SHIFT) - 1));
+  int pe = (int)(link >> BENCH_CHASE_PE_SHIFT);
+  shmem_getmem(ctx->source, chain + node * BENCH_CHASE_NODE,
+               BENCH_CHASE_NODE, pe);
+  ctx->chase = *(const long *)ctx->source;
+#endif
+}
+
+/**
+  @brief Get the chain buffers, lay a new random chain through them, walk
+  it untimed and start the walk at node 0 of PE 1. The untimed walk runs
+  BENCH_CHASE_WARM_HOPS hops of the op itself, so the first row does not
+  pay for first touches and connection setup. Cold rings are not used: past
+  the last level cache the chain is its own cold working set.
+  @param ctx Benchmark state; elem_count is the number of nodes per PE
+  @param hop Issue function following one link of the chain
+ */
+static void shmem_chase_prepare(bench_ctx_t *ctx,
+                                void (*hop)(bench_ctx_t *, int)) {
+  ctx->ring_bytes = 0;
+  bench_prepare_buffers(ctx, ctx->msg_size, ctx->max_msg_size);
+  shmem_barrier_all();
+  if (ctx->mype == 0) {
+    shmem_chase_build(ctx);
+    ctx->chase = SHMEM_CHASE_LINK(1, 0);
+    for (int h = 0; h < BENCH_CHASE_WARM_HOPS; h++) {
+      hop(ctx, h);
+    }
+  }
+  shmem_barrier_all();
+  ctx->chase = SHMEM_CHASE_LINK(1, 0);
+}
+
+/**
+  @brief Prepare a chain walked with shmem_long_g
+  @param ctx Benchmark state
+ */
+static void shmem_g_chase_prepare(bench_ctx_t *ctx) {
+  shmem_chase_prepare(ctx, shmem_g_chase_issue);
+}
+
+/**
+  @brief Prepare a chain walked with shmem_getmem
+  @param ctx Benchmark state
+ */
+static void shmem_getmem_chase_prepare(bench_ctx_t *ctx) {
+  shmem_chase_prepare(ctx, shmem_getmem_chase_issue);
+}
+
+/* PE 0 walks the chain with shmem_long_g */
+BENCH_DEFINE_OP(bench_shmem_g_chase,
+                .benchmark = "shmem_g",
+                .benchtype = "chase",
+                .pes = BENCH_ATLEAST_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .elem_size = BENCH_CHASE_NODE,
+                .elem_name = "64-byte chain node",
+                .prepare = shmem_g_chase_prepare,
+                .issue = shmem_g_chase_issue,
+                .complete = bench_complete_none);
+
+/* PE 0 walks the chain with shmem_getmem */
+BENCH_DEFINE_OP(bench_shmem_getmem_chase,
+                .benchmark = "shmem_getmem",
+                .benchtype = "chase",
+                .pes = BENCH_ATLEAST_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .elem_size = BENCH_CHASE_NODE,
+                .elem_name = "64-byte chain node",
+                .prepare = shmem_getmem_chase_prepare,
+                .issue = shmem_getmem_chase_issue,
+                .complete = bench_complete_none);
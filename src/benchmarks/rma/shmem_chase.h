@@ -0,0 +1,41 @@
+/**
+  @file shmem_chase.h
+  @brief Header file for the pointer-chasing get latency benchmarks with
+  support for OpenSHMEM 1.4 and 1.5
+*/
+
+#ifndef SHMEM_CHASE_H
+#define SHMEM_CHASE_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/* Bytes of one node of the chain, a cache line so every hop loads a line
+   of its own */
+#define BENCH_CHASE_NODE 64
+
+/* Bits of a chain link holding the node index; the target PE sits above */
+#define BENCH_CHASE_PE_SHIFT 48
+
+/* Hops of the untimed walk that warms a new chain, going round it as
+   often as it takes */
+#define BENCH_CHASE_WARM_HOPS 4096
+
+/**
+  @brief Pointer-chasing latency of shmem_long_g: every load returns the
+  PE and node of the next one
+ */
+extern const bench_op_t bench_shmem_g_chase;
+
+/**
+  @brief Pointer-chasing latency of shmem_getmem fetching whole nodes
+ */
+extern const bench_op_t bench_shmem_getmem_chase;
+
+#endif /* SHMEM_CHASE_H */
@@ -0,0 +1,156 @@
+/**
+  @file shmem_g.c
+  @brief Source file for the single-element shmem_g benchmarks with support
+  for OpenSHMEM 1.4 and 1.5
+*/
+
+#include "shmem_g.h"
+
+/**
+  @brief Fetch one long from the peer with shmem_long_g
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_g_peer_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  *(long *)ctx->dest = shmem_long_g((const long *)ctx->source, ctx->peer);
+#endif
+}
+
+/**
+  @brief Fetch one long from a random PE with shmem_long_g
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_g_issue(bench_ctx_t *ctx, int j) {
+#if defined(USE_14) || defined(USE_15)
+  *(long *)ctx->dest =
+      shmem_long_g((const long *)ctx->source, bench_target(ctx, j));
+#endif
+}
+
+/**
+  @brief Fetch one long from the peer with a one-element shmem_long_get
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_g_get_peer_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  shmem_long_get((long *)ctx->dest, (const long *)ctx->source, 1, ctx->peer);
+#endif
+}
+
+/**
+  @brief Fetch one long from a random PE with a one-element shmem_long_get
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_g_get_issue(bench_ctx_t *ctx, int j) {
+#if defined(USE_14) || defined(USE_15)
+  shmem_long_get((long *)ctx->dest, (const long *)ctx->source, 1,
+                 bench_target(ctx, j));
+#endif
+}
+
+/**
+  @brief Define the latency and mr ops of one type of shmem_g and of the
+  one-element get each is timed side by side with. Both routines block
+  until the element has arrived, so nothing is left to complete.
+  @param var Prefix of the shmem_g descriptors (var##_latency, var##_mr)
+  @param get_var Prefix of the get descriptors
+  @param routine Name of the shmem_g routine, e.g. "shmem_int_g"
+  @param get_routine Name of the get routine, e.g. "shmem_int_get"
+  @param type_name Name --type selects the variant by, e.g. "int"
+  @param c_name Element type, e.g. "int"
+  @param bytes Bytes per element
+  @param g_peer_fn, g_fn Issue hooks of shmem_g (peer, random PEs)
+  @param get_peer_fn, get_fn Issue hooks of the get (peer, random PEs)
+  @param latency_types, mr_types Typed arrays of the ops, or NULL
+ */
+#define SHMEM_G_DEFINE_OPS(var, get_var, routine, get_routine, type_name,      \
+                           c_name, bytes, g_peer_fn, g_fn, get_peer_fn,        \
+                           get_fn, latency_types, mr_types)                    \
+  extern const bench_op_t var##_latency, var##_mr, get_var##_latency,          \
+      get_var##_mr;                                                            \
+  BENCH_DEFINE_OP(get_var##_latency, .benchmark = get_routine,                 \
+                  .benchtype = "latency", .pes = BENCH_EXACTLY_2_PES,          \
+                  .issuers = BENCH_ISSUE_PE0, .elem_size = bytes,              \
+                  .elem_name = c_name, .op_name = "Operation",                 \
+                  .type = type_name, .prepare = bench_prepare_element,         \
+                  .issue = get_peer_fn, .complete = bench_complete_none);      \
+  BENCH_DEFINE_OP(get_var##_mr, .benchmark = get_routine, .benchtype = "mr",   \
+                  .pes = BENCH_ATLEAST_2_PES, .issuers = BENCH_ISSUE_ALL,      \
+                  .elem_size = bytes, .elem_name = c_name,                     \
+                  .op_name = "Operation", .type = type_name,                   \
+                  .prepare = bench_prepare_element, .issue = get_fn,           \
+                  .complete = bench_complete_none);                            \
+  BENCH_DEFINE_OP(var##_latency, .benchmark = routine,                         \
+                  .benchtype = "latency", .pes = BENCH_EXACTLY_2_PES,          \
+                  .issuers = BENCH_ISSUE_PE0, .elem_size = bytes,              \
+                  .elem_name = c_name, .op_name = "Operation",                 \
+                  .type = type_name, .prepare = bench_prepare_element,         \
+                  .issue = g_peer_fn, .complete = bench_complete_none,         \
+                  .compare = &get_var##_latency, .typed = latency_types);      \
+  BENCH_DEFINE_OP(var##_mr, .benchmark = routine, .benchtype = "mr",           \
+                  .pes = BENCH_ATLEAST_2_PES, .issuers = BENCH_ISSUE_ALL,      \
+                  .elem_size = bytes, .elem_name = c_name,                     \
+                  .op_name = "Operation", .type = type_name,                   \
+                  .prepare = bench_prepare_element, .issue = g_fn,             \
+                  .complete = bench_complete_none,                             \
+                  .compare = &get_var##_mr, .typed = mr_types)
+
+#if defined(USE_14) || defined(USE_15)
+/* Typed variants (see --type): shmem_TYPENAME_g of every standard RMA type,
+   each against the one-element shmem_TYPENAME_get */
+#define SHMEM_G_TYPED(name, type, routine)                                     \
+  static inline void shmem_g_##name##_peer_issue(bench_ctx_t *ctx, int j) {    \
+    (void)j;                                                                   \
+    *(type *)ctx->dest = shmem_##name##_g((const type *)ctx->source,           \
+                                          ctx->peer);                          \
+  }                                                                            \
+  static inline void shmem_g_##name##_issue(bench_ctx_t *ctx, int j) {         \
+    *(type *)ctx->dest = shmem_##name##_g((const type *)ctx->source,           \
+                                          bench_target(ctx, j));               \
+  }                                                                            \
+  static inline void shmem_g_get_##name##_peer_issue(bench_ctx_t *ctx,         \
+                                                     int j) {                  \
+    (void)j;                                                                   \
+    shmem_##name##_get((type *)ctx->dest, (const type *)ctx->source, 1,        \
+                       ctx->peer);                                             \
+  }                                                                            \
+  static inline void shmem_g_get_##name##_issue(bench_ctx_t *ctx, int j) {     \
+    shmem_##name##_get((type *)ctx->dest, (const type *)ctx->source, 1,        \
+                       bench_target(ctx, j));                                  \
+  }                                                                            \
+  SHMEM_G_DEFINE_OPS(bench_shmem_g_##name, bench_shmem_g_get_##name,           \
+                     "shmem_" #name "_g", "shmem_" #name "_get", #name,        \
+                     #type, sizeof(type), shmem_g_##name##_peer_issue,         \
+                     shmem_g_##name##_issue,                                   \
+                     shmem_g_get_##name##_peer_issue,                          \
+                     shmem_g_get_##name##_issue, NULL, NULL);
+
+BENCH_RMA_TYPES(SHMEM_G_TYPED, shmem_g)
+
+static const bench_op_t *const shmem_g_latency_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_LATENCY, shmem_g)
+    NULL};
+
+static const bench_op_t *const shmem_g_mr_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_MR, shmem_g)
+    NULL};
+#else
+#define shmem_g_latency_types NULL
+#define shmem_g_mr_types NULL
+#endif
+
+/* PE 0 fetches from PE 1, each g returning only once the element is back,
+   so the round trip is reported, next to a one-element get. Every PE g's
+   from random PEs back to back, and the same with a one-element get, for
+   the message rate. */
+SHMEM_G_DEFINE_OPS(bench_shmem_g, bench_shmem_g_get, "shmem_g",
+                   "shmem_long_get", NULL, "long", sizeof(long),
+                   shmem_g_peer_issue, shmem_g_issue, shmem_g_get_peer_issue,
+                   shmem_g_get_issue, shmem_g_latency_types,
+                   shmem_g_mr_types);
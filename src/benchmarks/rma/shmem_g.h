@@ -0,0 +1,30 @@
+/**
+  @file shmem_g.h
+  @brief Header file for the single-element shmem_g benchmarks with support
+  for OpenSHMEM 1.4 and 1.5
+*/
+
+#ifndef SHMEM_G_H
+#define SHMEM_G_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/**
+  @brief Round-trip latency of shmem_long_g, timed side by side with a
+  one-element shmem_long_get
+ */
+extern const bench_op_t bench_shmem_g_latency;
+
+/**
+  @brief Message rate of shmem_long_g from every PE to random PEs, timed
+  side by side with a one-element shmem_long_get
+ */
+extern const bench_op_t bench_shmem_g_mr;
+
+#endif /* SHMEM_G_H */
@@ -6,22 +6,22 @@
 #ifndef _SHMEM_GET_H_
 #define _SHMEM_GET_H_
 
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_get
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Bandwidth benchmark for shmem_get
  */
-void bench_shmem_get_bw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_get_bw;
 
 /**
-  @brief Run the bidirectional bandwidth benchmark for shmem_get
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Bidirectional bandwidth benchmark for shmem_get
  */
-void bench_shmem_get_bibw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_get_bibw;
 
 #endif /* _SHMEM_GET_H_ */
@@ -6,268 +6,106 @@
 #include "shmem_get_nbi.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_get_nbi
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Issue one shmem_get_nbi of msg_size bytes of longs with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
  */
-void bench_shmem_get_nbi_bw(int min_msg_size, int max_msg_size, int ntimes) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *bandwidths;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &bandwidths);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
-
-    /* Source and destination arrays for the shmem_get_nbi */
-    long *source = (long *)shmem_malloc(elem_count * sizeof(long));
-    long *dest = (long *)shmem_malloc(elem_count * sizeof(long));
-
-    /* Initialize source buffer */
-    for (int j = 0; j < elem_count; j++) {
-      source[j] = j;
-    }
-
-    /* Initialize start and end time */
-    double start_time, end_time;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Start timer */
-    start_time = mysecond();
-
-    /* Perform ntimes shmem_get_nbis */
-    if (mype == 0) {
-      for (int j = 0; j < ntimes; j++) {
+static inline void shmem_get_nbi_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
 #if defined(USE_14) || defined(USE_15)
-        shmem_get_nbi(dest, source, elem_count, 1);
-        shmem_quiet();
+  shmem_get_nbi((long *)ctx->dest, (const long *)ctx->source,
+                ctx->elem_count, ctx->peer);
 #endif
-      }
-    }
-
-    /* Stop timer */
-    end_time = mysecond();
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Calculate average time per operation in useconds */
-    times[i] = (end_time - start_time) * 1e6 / ntimes;
-
-    /* Calculate bandwidth using valid size */
-    bandwidths[i] = calculate_bw(valid_size, times[i]);
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (shmem_my_pe() == 0) {
-    display_results(times, msg_sizes, bandwidths, "bw", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(bandwidths);
 }
 
-/**
-  @brief Run the bidirectional bandwidth benchmark for shmem_get_nbi
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
- */
-void bench_shmem_get_nbi_bibw(int min_msg_size, int max_msg_size, int ntimes) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-  int peer = (mype == 0) ? 1 : 0;
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *bandwidths;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &bandwidths);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
-
-    /* Source and destination arrays for the shmem_get_nbi */
-    long *source = (long *)shmem_malloc(elem_count * sizeof(long));
-    long *dest = (long *)shmem_malloc(elem_count * sizeof(long));
-
-    /* Initialize source buffer */
-    for (int j = 0; j < elem_count; j++) {
-      source[j] = j;
-    }
-
-    /* Initialize start and end time */
-    double start_time, end_time;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Start timer */
-    start_time = mysecond();
-
-    /* Perform ntimes bidirectional shmem_get_nbis */
-    for (int j = 0; j < ntimes; j++) {
-#if defined(USE_14) || defined(USE_15)
-      shmem_get_nbi(dest, source, elem_count, peer); /* each PE gets from other PE */
-      shmem_quiet();
-#endif
-    }
-
-    /* Stop timer */
-    end_time = mysecond();
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Calculate average time per operation in useconds */
-    times[i] = (end_time - start_time) * 1e6 / (ntimes);
-
-    /* Calculate bidirectional bandwidth using valid size */
-    bandwidths[i] = calculate_bibw(valid_size, times[i]);
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, bandwidths, "bibw", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(bandwidths);
-}
-
-/*************************************************************
-  @brief Run the latency benchmark for shmem_get_nbi
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
- *************************************************************/
-void bench_shmem_get_nbi_latency(int min_msg_size, int max_msg_size,
-                                 int ntimes) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *latencies;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &latencies);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-    
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
-
-    /* Source and destination arrays for the shmem_get_nbi */
-    long *source = (long *)shmem_malloc(elem_count * sizeof(long));
-    long *dest = (long *)shmem_malloc(elem_count * sizeof(long));
-
-    /* Initialize source buffer */
-    for (int j = 0; j < elem_count; j++) {
-      source[j] = j;
-    }
-
-    /* Initialize total time */
-    double total_time = 0.0;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Perform ntimes shmem_get_nbis and accumulate total time */
-    if (mype == 0) {
-      for (int j = 0; j < ntimes; j++) {
-        double start_time = mysecond();
 #if defined(USE_14) || defined(USE_15)
-        shmem_get_nbi(dest, source, elem_count, 1);
-        shmem_quiet();
+/* Typed variants (see --type): shmem_TYPENAME_get_nbi of every standard RMA
+   type, shmem_getSIZE_nbi of every fixed size and shmem_getmem_nbi */
+#define SHMEM_GET_NBI_TYPED(name, type, routine)                               \
+  static inline void shmem_get_nbi_##name##_issue(bench_ctx_t *ctx, int j) {   \
+    (void)j;                                                                   \
+    shmem_##name##_get_nbi((type *)ctx->dest, (const type *)ctx->source,       \
+                           ctx->elem_count, ctx->peer);                        \
+  }                                                                            \
+  BENCH_DEFINE_TYPED_OPS(bench_shmem_get_nbi_##name,                           \
+                         "shmem_" #name "_get_nbi", #name, #type,              \
+                         sizeof(type), false, NULL,                            \
+                         shmem_get_nbi_##name##_issue);
+#define SHMEM_GET_NBI_SIZED(bits, bytes, routine)                              \
+  static inline void shmem_get_nbi_##bits##_issue(bench_ctx_t *ctx, int j) {   \
+    (void)j;                                                                   \
+    shmem_get##bits##_nbi(ctx->dest, ctx->source, ctx->elem_count, ctx->peer); \
+  }                                                                            \
+  BENCH_DEFINE_TYPED_OPS(bench_shmem_get_nbi_##bits, "shmem_get" #bits "_nbi", \
+                         #bits, #bits "-bit", bytes, false,                    \
+                         NULL, shmem_get_nbi_##bits##_issue);
+
+BENCH_RMA_TYPES(SHMEM_GET_NBI_TYPED, shmem_get_nbi)
+BENCH_SIZED_TYPES(SHMEM_GET_NBI_SIZED, shmem_get_nbi)
+
+static const bench_op_t *const shmem_get_nbi_bw_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_BW, shmem_get_nbi)
+    BENCH_SIZED_TYPES(BENCH_TYPED_ENTRY_BW, shmem_get_nbi)
+    &bench_shmem_getmem_nbi_bw,
+    NULL};
+
+static const bench_op_t *const shmem_get_nbi_bibw_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_BIBW, shmem_get_nbi)
+    BENCH_SIZED_TYPES(BENCH_TYPED_ENTRY_BIBW, shmem_get_nbi)
+    &bench_shmem_getmem_nbi_bibw,
+    NULL};
+#else
+#define shmem_get_nbi_bw_types NULL
+#define shmem_get_nbi_bibw_types NULL
 #endif
-        double end_time = mysecond();
-        total_time += (end_time - start_time) * 1e6;
-      }
-    }
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Calculate average latency per operation in microseconds */
-    times[i] = total_time / ntimes;
-
-    /* Record latency */
-    latencies[i] = times[i];
 
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, latencies, "latency", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(latencies);
-}
+/* PE 0 gets from PE 1 */
+BENCH_DEFINE_OP(bench_shmem_get_nbi_bw,
+                .benchmark = "shmem_get_nbi",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .issue = shmem_get_nbi_issue,
+                .typed = shmem_get_nbi_bw_types);
+
+/* Both PEs get from each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_get_nbi_bibw,
+                .benchmark = "shmem_get_nbi",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .issue = shmem_get_nbi_issue,
+                .typed = shmem_get_nbi_bibw_types);
+
+/* PE 0 gets from PE 1 in windows of back-to-back operations, one
+   shmem_quiet per window */
+BENCH_DEFINE_OP(bench_shmem_get_nbi_mr,
+                .benchmark = "shmem_get_nbi",
+                .benchtype = "mr",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .complete_at = BENCH_COMPLETE_WINDOW,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .issue = shmem_get_nbi_issue);
+
+/* PE 0 gets from PE 1, computing between issue and shmem_quiet of every
+   operation for as long as the transfer alone takes */
+BENCH_DEFINE_OP(bench_shmem_get_nbi_overlap,
+                .benchmark = "shmem_get_nbi",
+                .benchtype = "overlap",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .complete_at = BENCH_COMPLETE_EACH,
+                .sized = true,
+                .overlap = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .issue = shmem_get_nbi_issue);
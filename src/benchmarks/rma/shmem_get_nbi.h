@@ -15,19 +15,23 @@
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_get_nbi
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Bandwidth benchmark for shmem_get_nbi
  */
-void bench_shmem_get_nbi_bw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_get_nbi_bw;
 
 /**
-  @brief Run the bidirectional bandwidth benchmark for shmem_get_nbi
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Bidirectional bandwidth benchmark for shmem_get_nbi
  */
-void bench_shmem_get_nbi_bibw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_get_nbi_bibw;
+
+/**
+  @brief Windowed message-rate benchmark for shmem_get_nbi (see --window)
+ */
+extern const bench_op_t bench_shmem_get_nbi_mr;
+
+/**
+  @brief Communication/computation overlap benchmark for shmem_get_nbi
+ */
+extern const bench_op_t bench_shmem_get_nbi_overlap;
 
 #endif /* SHMEM_GET_NBI_H */
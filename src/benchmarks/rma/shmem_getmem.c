@@ -6,251 +6,48 @@
 #include "shmem_getmem.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_get
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Issue one shmem_getmem of msg_size bytes with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
  */
-void bench_shmem_getmem_bw(int min_msg_size, int max_msg_size, int ntimes) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *bandwidths;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &bandwidths);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Save message size */
-    msg_sizes[i] = size;
-
-    /* Source and destination byte arrays for the shmem_getmem */
-    unsigned char *source = (unsigned char *)shmem_malloc(size);
-    unsigned char *dest = (unsigned char *)shmem_malloc(size);
-
-    /* Initialize source buffer */
-    for (int j = 0; j < size; j++) {
-      source[j] = (unsigned char) j;
-    }
-
-    /* Initialize start and end time */
-    double start_time, end_time;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Start timer */
-    start_time = mysecond();
-
-    /* Perform ntimes shmem_getmems with P0 */
-    if (mype == 0) {
-      for (int j = 0; j < ntimes; j++) {
-#if defined(USE_14) || defined(USE_15)
-        shmem_getmem(dest, source, size, 1);
-#endif
-      }
-    }
-    
-    /* Stop timer */
-    end_time = mysecond();
-
-    /* Calculate average time per operation in useconds */
-    times[i] = (end_time - start_time) * 1e6 / ntimes;
-
-    /* Calculate bandwidth using actual bytes transferred */
-    bandwidths[i] = calculate_bw(size, times[i]);
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, bandwidths, "bw", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(bandwidths);
-}
-
-/*************************************************************
-  @brief Run the bidirectional bandwidth benchmark for shmem_get
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
- *************************************************************/
-void bench_shmem_getmem_bibw(int min_msg_size, int max_msg_size, int ntimes) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-  int peer = (mype == 0) ? 1 : 0;
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *bandwidths;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &bandwidths);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Save message size */
-    msg_sizes[i] = size;
-
-    /* Source and destination byte arrays for the shmem_getmem */
-    unsigned char *source = (unsigned char *)shmem_malloc(size);
-    unsigned char *dest = (unsigned char *)shmem_malloc(size);
-
-    /* Initialize source buffer */
-    for (int j = 0; j < size; j++) {
-      source[j] = (unsigned char) j;
-    }
-
-    /* Initialize start and end time */
-    double start_time, end_time;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Start timer */
-    start_time = mysecond();
-
-    /* Perform ntimes bidirectional shmem_getmems */
-    for (int j = 0; j < ntimes; j++) {
+static inline void shmem_getmem_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
 #if defined(USE_14) || defined(USE_15)
-      shmem_getmem(dest, source, size, peer); /* each PE gets from other PE */
+  shmem_getmem(ctx->dest, ctx->source, ctx->msg_size, ctx->peer);
 #endif
-    }
-
-    /* Stop timer */
-    end_time = mysecond();
-
-    /* Calculate average time per operation in useconds */
-    times[i] = (end_time - start_time) * 1e6 / (ntimes);
-    /* Calculate bidirectional bandwidth using actual bytes transferred */
-    bandwidths[i] = calculate_bibw(size, times[i]);
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (shmem_my_pe() == 0) {
-    display_results(times, msg_sizes, bandwidths, "bibw", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(bandwidths);
 }
 
-/*************************************************************
-  @brief Run the latency benchmark for shmem_get
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
- *************************************************************/
-void bench_shmem_getmem_latency(int min_msg_size, int max_msg_size, int ntimes) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *latencies;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &latencies);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Save message size and allocate byte buffers */
-    msg_sizes[i] = size;
-
-    /* Source and destination byte arrays for the shmem_getmem */
-    unsigned char *source = (unsigned char *)shmem_malloc(size);
-    unsigned char *dest = (unsigned char *)shmem_malloc(size);
-
-    /* Initialize source buffer */
-    for (int j = 0; j < size; j++) {
-      source[j] = (unsigned char) j;
-    }
-
-    /* Initialize total time */
-    double total_time = 0.0;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Perform ntimes shmem_gets and accumulate total time */
-    if (mype == 0) {
-      for (int j = 0; j < ntimes; j++) {
-        double start_time = mysecond();
-#if defined(USE_14) || defined(USE_15)
-        shmem_getmem(dest, source, size, 1);
-#endif
-        double end_time = mysecond();
-        total_time += (end_time - start_time) * 1e6;
-      }
-    }
-
-    /* Calculate average latency per operation in microseconds */
-    times[i] = total_time / ntimes;
-
-    /* Record latency */
-    latencies[i] = times[i];
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, latencies, "latency", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(latencies);
-}
+/* PE 0 gets from PE 1 */
+BENCH_DEFINE_OP(bench_shmem_getmem_bw,
+                .benchmark = "shmem_getmem",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .uses_offset = true,
+                .type = "mem",
+                .prepare = bench_prepare_offset,
+                .issue = shmem_getmem_issue);
+
+/* Both PEs get from each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_getmem_bibw,
+                .benchmark = "shmem_getmem",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .uses_offset = true,
+                .type = "mem",
+                .prepare = bench_prepare_offset,
+                .issue = shmem_getmem_issue);
+
+/* PE 0 gets from PE 1 with both buffers shifted by every offset of the
+   alignment sweep, reporting the bandwidth lost against offset 0 */
+BENCH_DEFINE_OP(bench_shmem_getmem_align,
+                .benchmark = "shmem_getmem",
+                .benchtype = "align",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .prepare = bench_prepare_offset,
+                .issue = shmem_getmem_issue);
@@ -6,22 +6,28 @@
 #ifndef _SHMEM_GETMEM_H_
 #define _SHMEM_GETMEM_H_
 
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_getmem
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Bandwidth benchmark for shmem_getmem
+ */
+extern const bench_op_t bench_shmem_getmem_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark for shmem_getmem
  */
-void bench_shmem_getmem_bw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_getmem_bibw;
 
 /**
-  @brief Run the bidirectional bandwidth benchmark for shmem_getmem
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Alignment sweep of shmem_getmem: bandwidth at every source and
+  destination offset of bench_align_offsets against offset 0
  */
-void bench_shmem_getmem_bibw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_getmem_align;
 
 #endif /* _SHMEM_GETMEM_H_ */
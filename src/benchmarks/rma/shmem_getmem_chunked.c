@@ -0,0 +1,48 @@
+/**
+  @file shmem_getmem_chunked.c
+  @author Michael Beebe (Texas Tech University)
+*/
+
+#include "shmem_getmem_chunked.h"
+
+/**
+  @brief Issue one transfer of msg_size bytes from the peer as ctx->chunks
+  back-to-back shmem_getmem_nbi pieces; the shmem_quiet after the
+  operation completes them all
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_getmem_chunked_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  size_t piece = bench_chunk_bytes(ctx);
+  char *dest = (char *)ctx->dest;
+  const char *source = (const char *)ctx->source;
+  for (size_t at = 0; at < ctx->msg_size; at += piece) {
+    size_t bytes = ctx->msg_size - at < piece ? ctx->msg_size - at : piece;
+    shmem_getmem_nbi(dest + at, source + at, bytes, ctx->peer);
+  }
+#endif
+}
+
+/* PE 0 gets from PE 1, completing every chunked transfer before the next */
+BENCH_DEFINE_OP(bench_shmem_getmem_chunked_bw,
+                .benchmark = "shmem_getmem_chunked",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .complete_at = BENCH_COMPLETE_EACH,
+                .sized = true,
+                .uses_chunks = true,
+                .issue = shmem_getmem_chunked_issue);
+
+/* Both PEs get from each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_getmem_chunked_bibw,
+                .benchmark = "shmem_getmem_chunked",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .complete_at = BENCH_COMPLETE_EACH,
+                .sized = true,
+                .uses_chunks = true,
+                .issue = shmem_getmem_chunked_issue);
@@ -0,0 +1,29 @@
+/**
+  @file shmem_getmem_chunked.h
+  @author Michael Beebe (Texas Tech University)
+*/
+
+#ifndef SHMEM_GETMEM_CHUNKED_H
+#define SHMEM_GETMEM_CHUNKED_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/**
+  @brief Bandwidth benchmark of one transfer split into --chunks
+  shmem_getmem_nbi pieces in flight at once
+ */
+extern const bench_op_t bench_shmem_getmem_chunked_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark of one transfer split into
+  --chunks shmem_getmem_nbi pieces in flight at once
+ */
+extern const bench_op_t bench_shmem_getmem_chunked_bibw;
+
+#endif /* SHMEM_GETMEM_CHUNKED_H */
@@ -0,0 +1,56 @@
+/**
+  @file shmem_getmem_unpacked.c
+  @brief Source file for shmem_getmem_unpacked benchmarks with support for
+  OpenSHMEM 1.4 and 1.5
+  The contiguous alternative to shmem_iget a one-sided get has: the whole
+  strided span is fetched with one shmem_getmem and the wanted elements are
+  unpacked from it locally
+*/
+
+#include "shmem_getmem_unpacked.h"
+
+/**
+  @brief Get the span covering elem_count longs strided by --stride from the
+  peer with one shmem_getmem, then unpack the elements into a contiguous
+  buffer, leaving the same data as shmem_iget
+  @param ctx Benchmark state prepared by bench_prepare_staged
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_getmem_unpacked_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+  if (ctx->elem_count == 0) {
+    return;
+  }
+  size_t span = ((ctx->elem_count - 1) * ctx->stride + 1) * sizeof(long);
+#if defined(USE_14) || defined(USE_15)
+  shmem_getmem(ctx->staging, ctx->source, span, ctx->peer);
+#endif
+  pack_strided_longs((long *)ctx->dest, (const long *)ctx->staging,
+                     ctx->stride, ctx->elem_count);
+}
+
+/* PE 0 gets and unpacks from PE 1 */
+BENCH_DEFINE_OP(bench_shmem_getmem_unpacked_bw,
+                .benchmark = "shmem_getmem_unpacked",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .uses_stride = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_staged,
+                .issue = shmem_getmem_unpacked_issue);
+
+/* Both PEs get and unpack from each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_getmem_unpacked_bibw,
+                .benchmark = "shmem_getmem_unpacked",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .uses_stride = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_staged,
+                .issue = shmem_getmem_unpacked_issue);
@@ -0,0 +1,29 @@
+/**
+  @file shmem_getmem_unpacked.h
+  @brief Header file for shmem_getmem_unpacked benchmarks with support for
+  OpenSHMEM 1.4 and 1.5
+*/
+
+#ifndef SHMEM_GETMEM_UNPACKED_H
+#define SHMEM_GETMEM_UNPACKED_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pack.h"
+#include "shmembench.h"
+
+/**
+  @brief Bandwidth benchmark for shmem_getmem_unpacked
+ */
+extern const bench_op_t bench_shmem_getmem_unpacked_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark for shmem_getmem_unpacked
+ */
+extern const bench_op_t bench_shmem_getmem_unpacked_bibw;
+
+#endif /* SHMEM_GETMEM_UNPACKED_H */
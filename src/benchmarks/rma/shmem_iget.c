@@ -7,271 +7,98 @@
 #include "shmem_iget.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_iget
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
-  @param stride Stride for shmem_iget
+  @brief Issue one shmem_iget of elem_count longs strided by --stride
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
  */
-void bench_shmem_iget_bw(int min_msg_size, int max_msg_size, int ntimes,
-                         int stride) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *bandwidths;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &bandwidths);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
-
-    /* Source and destination arrays plus additional size for stride */
-    long *source = (long *)shmem_malloc((elem_count * stride) * sizeof(long));
-    long *dest = (long *)shmem_malloc((elem_count * stride) * sizeof(long));
-
-    /* Initialize source buffer */
-    for (int j = 0; j < elem_count * stride; j++) {
-      source[j] = j;
-    }
-
-    /* Initialize start and end time */
-    double start_time, end_time;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Start timer */
-    start_time = mysecond();
-
-    /* Perform ntimes shmem_igets */
-    if (mype == 0) {
-      for (int j = 0; j < ntimes; j++) {
+static inline void shmem_iget_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
 #if defined(USE_14) || defined(USE_15)
-        shmem_iget(dest, source, 1, stride, elem_count, 1);
+  shmem_iget((long *)ctx->dest, (const long *)ctx->source, 1,
+             ctx->stride, ctx->elem_count, ctx->peer);
 #endif
-      }
-    }
-
-    /* Stop timer */
-    end_time = mysecond();
-
-    /* Calculate average time per operation in useconds */
-    times[i] = (end_time - start_time) * 1e6 / ntimes;
-
-    /* Calculate bandwidth using valid size */
-    bandwidths[i] = calculate_bw(valid_size, times[i]);
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, bandwidths, "bw", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(bandwidths);
 }
 
-/*************************************************************
-  @brief Run the bidirectional bandwidth benchmark for shmem_iget
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
-  @param stride Stride between consecutive elements
- *************************************************************/
-void bench_shmem_iget_bibw(int min_msg_size, int max_msg_size, int ntimes,
-                           int stride) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-  int peer = (mype == 0) ? 1 : 0;
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *bandwidths;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &bandwidths);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
-
-    /* Source and destination arrays plus additional size for stride */
-    long *source = (long *)shmem_malloc((elem_count * stride) * sizeof(long));
-    long *dest = (long *)shmem_malloc((elem_count * stride) * sizeof(long));
-
-    /* Initialize source buffer */
-    for (int j = 0; j < elem_count * stride; j++) {
-      source[j] = j;
-      dest[j] = j;
-    }
-
-    /* Initialize start and end time */
-    double start_time, end_time;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Start timer */
-    start_time = mysecond();
-
-    /* Perform ntimes bidirectional shmem_igets */
-    for (int j = 0; j < ntimes; j++) {
 #if defined(USE_14) || defined(USE_15)
-      shmem_iget(dest, source, 1, stride, elem_count, peer); /* each PE sends to other PE */
+/* Typed variants (see --type): shmem_TYPENAME_iget of every standard RMA
+   type, shmem_igetSIZE of every fixed size */
+#define SHMEM_IGET_TYPED(name, type, routine)                                  \
+  static inline void shmem_iget_##name##_issue(bench_ctx_t *ctx, int j) {      \
+    (void)j;                                                                   \
+    shmem_##name##_iget((type *)ctx->dest, (const type *)ctx->source, 1,       \
+                        ctx->stride, ctx->elem_count, ctx->peer);              \
+  }                                                                            \
+  BENCH_DEFINE_TYPED_OPS(bench_shmem_iget_##name,                              \
+                         "shmem_" #name "_iget", #name, #type,                 \
+                         sizeof(type), true, bench_prepare_strided,            \
+                         shmem_iget_##name##_issue);
+#define SHMEM_IGET_SIZED(bits, bytes, routine)                                 \
+  static inline void shmem_iget_##bits##_issue(bench_ctx_t *ctx, int j) {      \
+    (void)j;                                                                   \
+    shmem_iget##bits(ctx->dest, ctx->source, 1, ctx->stride,                   \
+                     ctx->elem_count, ctx->peer);                              \
+  }                                                                            \
+  BENCH_DEFINE_TYPED_OPS(bench_shmem_iget_##bits, "shmem_iget" #bits,          \
+                         #bits, #bits "-bit", bytes, true,                     \
+                         bench_prepare_strided,                                \
+                         shmem_iget_##bits##_issue);
+
+BENCH_RMA_TYPES(SHMEM_IGET_TYPED, shmem_iget)
+BENCH_SIZED_TYPES(SHMEM_IGET_SIZED, shmem_iget)
+
+static const bench_op_t *const shmem_iget_bw_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_BW, shmem_iget)
+    BENCH_SIZED_TYPES(BENCH_TYPED_ENTRY_BW, shmem_iget)
+    NULL};
+
+static const bench_op_t *const shmem_iget_bibw_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_BIBW, shmem_iget)
+    BENCH_SIZED_TYPES(BENCH_TYPED_ENTRY_BIBW, shmem_iget)
+    NULL};
+#else
+#define shmem_iget_bw_types NULL
+#define shmem_iget_bibw_types NULL
 #endif
-    }
-
-    /* Stop timer */
-    end_time = mysecond();
-
-    /* Calculate average time per operation in useconds */
-    times[i] = (end_time - start_time) * 1e6 / (ntimes);
-
-    /* Calculate bidirectional bandwidth using valid size */
-    bandwidths[i] = calculate_bibw(valid_size, times[i]);
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, bandwidths, "bibw", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(bandwidths);
-}
-
-/*************************************************************
-  @brief Run the latency benchmark for shmem_iget
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
-  @param stride Stride between consecutive elements
- *************************************************************/
-void bench_shmem_iget_latency(int min_msg_size, int max_msg_size, int ntimes,
-                              int stride) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *latencies;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &latencies);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-    
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
 
-    /* Source and destination arrays plus additional size for stride */
-    long *source = (long *)shmem_malloc((elem_count *  stride) * sizeof(long));
-    long *dest = (long *)shmem_malloc((elem_count * stride) * sizeof(long));
-
-    /* Initialize source buffer */
-    for (int j = 0; j < elem_count * stride; j++) {
-      source[j] = j;
-    }
-
-    /* Initialize total time */
-    double total_time = 0.0;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Perform ntimes shmem_igets and accumulate total time */
-    if (mype == 0) {
-      for (int j = 0; j < ntimes; j++) {
-        double start_time = mysecond();
-#if defined(USE_14) || defined(USE_15)
-        shmem_iget(dest, source, 1, stride, elem_count, 1);
-#endif
-        double end_time = mysecond();
-        total_time += (end_time - start_time) * 1e6;
-      }
-    }
-
-    /* Calculate average latency per operation in microseconds */
-    times[i] = total_time / ntimes;
-
-    /* Record latency */
-    latencies[i] = times[i];
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, latencies, "latency", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(latencies);
-}
+/* PE 0 gets from PE 1 */
+BENCH_DEFINE_OP(bench_shmem_iget_bw,
+                .benchmark = "shmem_iget",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .uses_stride = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_strided,
+                .issue = shmem_iget_issue,
+                .typed = shmem_iget_bw_types);
+
+/* Both PEs get from each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_iget_bibw,
+                .benchmark = "shmem_iget",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .uses_stride = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_strided,
+                .issue = shmem_iget_issue,
+                .typed = shmem_iget_bibw_types);
+
+/* PE 0 gets from PE 1, timed side by side with getting the strided span
+   with shmem_getmem and unpacking the elements */
+BENCH_DEFINE_OP(bench_shmem_iget_pack,
+                .benchmark = "shmem_iget",
+                .benchtype = "pack",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .uses_stride = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_staged,
+                .issue = shmem_iget_issue,
+                .compare = &bench_shmem_getmem_unpacked_bw);
@@ -15,23 +15,18 @@
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_iget
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
-  @param stride Stride for shmem_iget
+  @brief Bandwidth benchmark for shmem_iget
  */
-void bench_shmem_iget_bw(int min_msg_size, int max_msg_size, int ntimes,
-                         int stride);
+extern const bench_op_t bench_shmem_iget_bw;
 
 /**
-  @brief Run the bidirectional bandwidth benchmark for shmem_iget
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
-  @param stride Stride for shmem_iget
+  @brief Bidirectional bandwidth benchmark for shmem_iget
  */
-void bench_shmem_iget_bibw(int min_msg_size, int max_msg_size, int ntimes,
-                           int stride);
+extern const bench_op_t bench_shmem_iget_bibw;
+
+/**
+  @brief Bandwidth of shmem_iget side by side with shmem_getmem_unpacked
+ */
+extern const bench_op_t bench_shmem_iget_pack;
 
 #endif /* SHMEM_IGET_H */
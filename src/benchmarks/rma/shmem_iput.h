@@ -15,23 +15,18 @@
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_iput
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
-  @param stride Stride for shmem_iput
+  @brief Bandwidth benchmark for shmem_iput
  */
-void bench_shmem_iput_bw(int min_msg_size, int max_msg_size, int ntimes,
-                         int stride);
+extern const bench_op_t bench_shmem_iput_bw;
 
 /**
-  @brief Run the bidirectional bandwidth benchmark for shmem_iput
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
-  @param stride Stride for shmem_iput
+  @brief Bidirectional bandwidth benchmark for shmem_iput
  */
-void bench_shmem_iput_bibw(int min_msg_size, int max_msg_size, int ntimes,
-                           int stride);
+extern const bench_op_t bench_shmem_iput_bibw;
+
+/**
+  @brief Bandwidth of shmem_iput side by side with shmem_putmem_packed
+ */
+extern const bench_op_t bench_shmem_iput_pack;
 
 #endif /* SHMEM_IPUT_H */
@@ -0,0 +1,183 @@
+/**
+  @file shmem_p.c
+  @brief Source file for the single-element shmem_p benchmarks with support
+  for OpenSHMEM 1.4 and 1.5
+*/
+
+#include "shmem_p.h"
+
+/**
+  @brief Issue one shmem_long_p to the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_p_peer_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  shmem_long_p((long *)ctx->dest, *(const long *)ctx->source, ctx->peer);
+#endif
+}
+
+/**
+  @brief Issue one shmem_long_p on a random PE
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_p_issue(bench_ctx_t *ctx, int j) {
+#if defined(USE_14) || defined(USE_15)
+  shmem_long_p((long *)ctx->dest, *(const long *)ctx->source,
+               bench_target(ctx, j));
+#endif
+}
+
+/**
+  @brief One ping-pong round trip of shmem_long_p with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_p_pingpong_issue(bench_ctx_t *ctx, int j) {
+  bench_pingpong(ctx, j, shmem_p_peer_issue);
+}
+
+/**
+  @brief Issue a one-element shmem_long_put to the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_p_put_peer_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  shmem_long_put((long *)ctx->dest, (const long *)ctx->source, 1, ctx->peer);
+#endif
+}
+
+/**
+  @brief Issue a one-element shmem_long_put on a random PE
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_p_put_issue(bench_ctx_t *ctx, int j) {
+#if defined(USE_14) || defined(USE_15)
+  shmem_long_put((long *)ctx->dest, (const long *)ctx->source, 1,
+                 bench_target(ctx, j));
+#endif
+}
+
+/**
+  @brief One ping-pong round trip of a one-element shmem_long_put with the
+  peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_p_put_pingpong_issue(bench_ctx_t *ctx, int j) {
+  bench_pingpong(ctx, j, shmem_p_put_peer_issue);
+}
+
+/**
+  @brief Define the latency and mr ops of one type of shmem_p and of the
+  one-element put each is timed side by side with
+  @param var Prefix of the shmem_p descriptors (var##_latency, var##_mr)
+  @param put_var Prefix of the put descriptors
+  @param routine Name of the shmem_p routine, e.g. "shmem_int_p"
+  @param put_routine Name of the put routine, e.g. "shmem_int_put"
+  @param type_name Name --type selects the variant by, e.g. "int"
+  @param c_name Element type, e.g. "int"
+  @param bytes Bytes per element
+  @param p_fn, p_pingpong_fn Issue hooks of shmem_p
+  @param put_fn, put_pingpong_fn Issue hooks of the put
+  @param latency_types, mr_types Typed arrays of the ops, or NULL
+ */
+#define SHMEM_P_DEFINE_OPS(var, put_var, routine, put_routine, type_name,      \
+                           c_name, bytes, p_fn, p_pingpong_fn, put_fn,         \
+                           put_pingpong_fn, latency_types, mr_types)           \
+  extern const bench_op_t var##_latency, var##_mr, put_var##_latency,          \
+      put_var##_mr;                                                            \
+  BENCH_DEFINE_OP(put_var##_latency, .benchmark = put_routine,                 \
+                  .benchtype = "latency", .pes = BENCH_EXACTLY_2_PES,          \
+                  .issuers = BENCH_ISSUE_COLLECTIVE, .elem_size = bytes,       \
+                  .elem_name = c_name, .op_name = "Operation",                 \
+                  .transfers = 2, .type = type_name,                           \
+                  .prepare = bench_prepare_element,                            \
+                  .issue = put_pingpong_fn,                                    \
+                  .complete = bench_complete_none);                            \
+  BENCH_DEFINE_OP(put_var##_mr, .benchmark = put_routine, .benchtype = "mr",   \
+                  .pes = BENCH_ATLEAST_2_PES, .issuers = BENCH_ISSUE_ALL,      \
+                  .elem_size = bytes, .elem_name = c_name,                     \
+                  .op_name = "Operation", .type = type_name,                   \
+                  .prepare = bench_prepare_element, .issue = put_fn);          \
+  BENCH_DEFINE_OP(var##_latency, .benchmark = routine,                         \
+                  .benchtype = "latency", .pes = BENCH_EXACTLY_2_PES,          \
+                  .issuers = BENCH_ISSUE_COLLECTIVE, .elem_size = bytes,       \
+                  .elem_name = c_name, .op_name = "Operation",                 \
+                  .transfers = 2, .type = type_name,                           \
+                  .prepare = bench_prepare_element, .issue = p_pingpong_fn,    \
+                  .complete = bench_complete_none,                             \
+                  .compare = &put_var##_latency, .typed = latency_types);      \
+  BENCH_DEFINE_OP(var##_mr, .benchmark = routine, .benchtype = "mr",           \
+                  .pes = BENCH_ATLEAST_2_PES, .issuers = BENCH_ISSUE_ALL,      \
+                  .elem_size = bytes, .elem_name = c_name,                     \
+                  .op_name = "Operation", .type = type_name,                   \
+                  .prepare = bench_prepare_element, .issue = p_fn,             \
+                  .compare = &put_var##_mr, .typed = mr_types)
+
+#if defined(USE_14) || defined(USE_15)
+/* Typed variants (see --type): shmem_TYPENAME_p of every standard RMA type,
+   each against the one-element shmem_TYPENAME_put */
+#define SHMEM_P_TYPED(name, type, routine)                                     \
+  static inline void shmem_p_##name##_peer_issue(bench_ctx_t *ctx, int j) {    \
+    (void)j;                                                                   \
+    shmem_##name##_p((type *)ctx->dest, *(const type *)ctx->source,            \
+                     ctx->peer);                                               \
+  }                                                                            \
+  static inline void shmem_p_##name##_issue(bench_ctx_t *ctx, int j) {         \
+    shmem_##name##_p((type *)ctx->dest, *(const type *)ctx->source,            \
+                     bench_target(ctx, j));                                    \
+  }                                                                            \
+  static inline void shmem_p_##name##_pingpong_issue(bench_ctx_t *ctx,         \
+                                                     int j) {                  \
+    bench_pingpong(ctx, j, shmem_p_##name##_peer_issue);                       \
+  }                                                                            \
+  static inline void shmem_p_put_##name##_peer_issue(bench_ctx_t *ctx,         \
+                                                     int j) {                  \
+    (void)j;                                                                   \
+    shmem_##name##_put((type *)ctx->dest, (const type *)ctx->source, 1,        \
+                       ctx->peer);                                             \
+  }                                                                            \
+  static inline void shmem_p_put_##name##_issue(bench_ctx_t *ctx, int j) {     \
+    shmem_##name##_put((type *)ctx->dest, (const type *)ctx->source, 1,        \
+                       bench_target(ctx, j));                                  \
+  }                                                                            \
+  static inline void shmem_p_put_##name##_pingpong_issue(bench_ctx_t *ctx,     \
+                                                         int j) {              \
+    bench_pingpong(ctx, j, shmem_p_put_##name##_peer_issue);                   \
+  }                                                                            \
+  SHMEM_P_DEFINE_OPS(bench_shmem_p_##name, bench_shmem_p_put_##name,           \
+                     "shmem_" #name "_p", "shmem_" #name "_put", #name,        \
+                     #type, sizeof(type), shmem_p_##name##_issue,              \
+                     shmem_p_##name##_pingpong_issue,                          \
+                     shmem_p_put_##name##_issue,                               \
+                     shmem_p_put_##name##_pingpong_issue, NULL, NULL);
+
+BENCH_RMA_TYPES(SHMEM_P_TYPED, shmem_p)
+
+static const bench_op_t *const shmem_p_latency_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_LATENCY, shmem_p)
+    NULL};
+
+static const bench_op_t *const shmem_p_mr_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_MR, shmem_p)
+    NULL};
+#else
+#define shmem_p_latency_types NULL
+#define shmem_p_mr_types NULL
+#endif
+
+/* PE 0 and PE 1 p back and forth, each waiting for the other's flag, and
+   the same with a one-element put; half the round trip is reported.
+   Every PE p's to random PEs with one shmem_quiet per batch, and the
+   same with a one-element put, for the message rate. */
+SHMEM_P_DEFINE_OPS(bench_shmem_p, bench_shmem_p_put, "shmem_p",
+                   "shmem_long_put", NULL, "long", sizeof(long),
+                   shmem_p_issue, shmem_p_pingpong_issue, shmem_p_put_issue,
+                   shmem_p_put_pingpong_issue, shmem_p_latency_types,
+                   shmem_p_mr_types);
@@ -0,0 +1,30 @@
+/**
+  @file shmem_p.h
+  @brief Header file for the single-element shmem_p benchmarks with support
+  for OpenSHMEM 1.4 and 1.5
+*/
+
+#ifndef SHMEM_P_H
+#define SHMEM_P_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/**
+  @brief Ping-pong latency of shmem_long_p, timed side by side with a
+  one-element shmem_long_put
+ */
+extern const bench_op_t bench_shmem_p_latency;
+
+/**
+  @brief Message rate of shmem_long_p from every PE to random PEs, timed
+  side by side with a one-element shmem_long_put
+ */
+extern const bench_op_t bench_shmem_p_mr;
+
+#endif /* SHMEM_P_H */
@@ -0,0 +1,176 @@
+/**
+  @file shmem_ptr.c
+  @brief Source file for shmem_ptr benchmarks with support for OpenSHMEM
+  1.4 and 1.5
+  Direct stores into a peer on the same node: the peer's buffer is mapped
+  with shmem_ptr and written with memcpy, a non-temporal streaming copy or
+  a scalar loop instead of shmem_putmem
+*/
+
+#include "shmem_ptr.h"
+
+/* Streaming copy picked for this CPU by the first prepare */
+static copy_fn_t shmem_ptr_stream_copy = NULL;
+
+/**
+  @brief Map the peer's buffer and pick the streaming copy of this CPU,
+  noting which one once
+  @param ctx Benchmark state
+ */
+static void shmem_ptr_stream_prepare(bench_ctx_t *ctx) {
+  bench_prepare_direct(ctx);
+  if (shmem_ptr_stream_copy == NULL) {
+    const char *isa;
+    shmem_ptr_stream_copy = copy_stream_select(&isa);
+    if (ctx->mype == 0) {
+      fprintf(stderr, "Note: shmem_ptr_stream copies with %s%s.\n", isa,
+              strcmp(isa, "memcpy") == 0 ? "" : " non-temporal stores");
+    }
+  }
+}
+
+/**
+  @brief memcpy msg_size bytes straight into the peer's buffer
+  @param ctx Benchmark state prepared by bench_prepare_direct
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_ptr_memcpy_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+  memcpy(ctx->remote, ctx->source, ctx->msg_size);
+}
+
+/**
+  @brief Stream msg_size bytes into the peer's buffer past the cache
+  @param ctx Benchmark state prepared by shmem_ptr_stream_prepare
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_ptr_stream_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+  shmem_ptr_stream_copy(ctx->remote, ctx->source, ctx->msg_size);
+}
+
+/**
+  @brief Store msg_size bytes into the peer's buffer one long at a time
+  @param ctx Benchmark state prepared by bench_prepare_direct
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_ptr_scalar_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+  copy_scalar(ctx->remote, ctx->source, ctx->msg_size);
+}
+
+/**
+  @brief Fence the weakly ordered streaming stores, then complete them
+  like any other store to symmetric memory
+  @param ctx Benchmark state
+ */
+static inline void shmem_ptr_stream_complete(bench_ctx_t *ctx) {
+  (void)ctx;
+  copy_stream_fence();
+  shmem_quiet();
+}
+
+/* PE 0 copies into PE 1 */
+BENCH_DEFINE_OP(bench_shmem_ptr_memcpy_bw,
+                .benchmark = "shmem_ptr_memcpy",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .direct = true,
+                .prepare = bench_prepare_direct,
+                .issue = shmem_ptr_memcpy_issue);
+
+/* Both PEs copy into each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_ptr_memcpy_bibw,
+                .benchmark = "shmem_ptr_memcpy",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .direct = true,
+                .prepare = bench_prepare_direct,
+                .issue = shmem_ptr_memcpy_issue);
+
+/* PE 0 copies into PE 1, then puts the same sizes with shmem_putmem */
+BENCH_DEFINE_OP(bench_shmem_ptr_memcpy_rma,
+                .benchmark = "shmem_ptr_memcpy",
+                .benchtype = "rma",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .direct = true,
+                .compare = &bench_shmem_putmem_bw,
+                .prepare = bench_prepare_direct,
+                .issue = shmem_ptr_memcpy_issue);
+
+/* PE 0 streams into PE 1 */
+BENCH_DEFINE_OP(bench_shmem_ptr_stream_bw,
+                .benchmark = "shmem_ptr_stream",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .direct = true,
+                .prepare = shmem_ptr_stream_prepare,
+                .issue = shmem_ptr_stream_issue,
+                .complete = shmem_ptr_stream_complete);
+
+/* Both PEs stream into each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_ptr_stream_bibw,
+                .benchmark = "shmem_ptr_stream",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .direct = true,
+                .prepare = shmem_ptr_stream_prepare,
+                .issue = shmem_ptr_stream_issue,
+                .complete = shmem_ptr_stream_complete);
+
+/* PE 0 streams into PE 1, then puts the same sizes with shmem_putmem */
+BENCH_DEFINE_OP(bench_shmem_ptr_stream_rma,
+                .benchmark = "shmem_ptr_stream",
+                .benchtype = "rma",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .direct = true,
+                .compare = &bench_shmem_putmem_bw,
+                .prepare = shmem_ptr_stream_prepare,
+                .issue = shmem_ptr_stream_issue,
+                .complete = shmem_ptr_stream_complete);
+
+/* PE 0 stores into PE 1 one long at a time */
+BENCH_DEFINE_OP(bench_shmem_ptr_scalar_bw,
+                .benchmark = "shmem_ptr_scalar",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .direct = true,
+                .prepare = bench_prepare_direct,
+                .issue = shmem_ptr_scalar_issue);
+
+/* Both PEs store into each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_ptr_scalar_bibw,
+                .benchmark = "shmem_ptr_scalar",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .direct = true,
+                .prepare = bench_prepare_direct,
+                .issue = shmem_ptr_scalar_issue);
+
+/* PE 0 stores into PE 1, then puts the same sizes with shmem_putmem */
+BENCH_DEFINE_OP(bench_shmem_ptr_scalar_rma,
+                .benchmark = "shmem_ptr_scalar",
+                .benchtype = "rma",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .direct = true,
+                .compare = &bench_shmem_putmem_bw,
+                .prepare = bench_prepare_direct,
+                .issue = shmem_ptr_scalar_issue);
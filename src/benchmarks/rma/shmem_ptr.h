@@ -0,0 +1,70 @@
+/**
+  @file shmem_ptr.h
+  @brief Header file for shmem_ptr benchmarks with support for OpenSHMEM
+  1.4 and 1.5
+*/
+
+#ifndef SHMEM_PTR_H
+#define SHMEM_PTR_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "copy.h"
+#include "shmembench.h"
+
+/**
+  @brief Bandwidth benchmark of memcpy into the peer through shmem_ptr
+ */
+extern const bench_op_t bench_shmem_ptr_memcpy_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark of memcpy through shmem_ptr
+ */
+extern const bench_op_t bench_shmem_ptr_memcpy_bibw;
+
+/**
+  @brief memcpy through shmem_ptr timed side by side with shmem_putmem
+ */
+extern const bench_op_t bench_shmem_ptr_memcpy_rma;
+
+/**
+  @brief Bandwidth benchmark of a non-temporal streaming copy into the peer
+  through shmem_ptr
+ */
+extern const bench_op_t bench_shmem_ptr_stream_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark of a non-temporal streaming copy
+  through shmem_ptr
+ */
+extern const bench_op_t bench_shmem_ptr_stream_bibw;
+
+/**
+  @brief Non-temporal streaming copy through shmem_ptr timed side by side
+  with shmem_putmem
+ */
+extern const bench_op_t bench_shmem_ptr_stream_rma;
+
+/**
+  @brief Bandwidth benchmark of a scalar load/store loop into the peer
+  through shmem_ptr
+ */
+extern const bench_op_t bench_shmem_ptr_scalar_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark of a scalar load/store loop
+  through shmem_ptr
+ */
+extern const bench_op_t bench_shmem_ptr_scalar_bibw;
+
+/**
+  @brief Scalar load/store loop through shmem_ptr timed side by side with
+  shmem_putmem
+ */
+extern const bench_op_t bench_shmem_ptr_scalar_rma;
+
+#endif /* SHMEM_PTR_H */
@@ -6,269 +6,103 @@
 #include "shmem_put.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_put
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Issue one shmem_put of msg_size bytes of longs with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
  */
-void bench_shmem_put_bw(int min_msg_size, int max_msg_size, int ntimes) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *bandwidths;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &bandwidths);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
-
-    /* Source and destination arrays for the shmem_put */
-    long *source = (long *)shmem_malloc(elem_count * sizeof(long));
-    long *dest = (long *)shmem_malloc(elem_count * sizeof(long));
-
-    /* Initialize source buffer */
-    for (int j = 0; j < elem_count; j++) {
-      source[j] = j;
-    }
-
-    /* Initialize start and end time */
-    double start_time, end_time;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Start timer */
-    start_time = mysecond();
-
-    /* Perform ntimes shmem_puts */
-    if (mype == 0) {
-      for (int j = 0; j < ntimes; j++) {
+static inline void shmem_put_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
 #if defined(USE_14) || defined(USE_15)
-        shmem_put(dest, source, elem_count, 1);
-        shmem_fence();
+  shmem_put((long *)ctx->dest, (const long *)ctx->source,
+            ctx->elem_count, ctx->peer);
 #endif
-      }
-      shmem_quiet();
-    }
-
-    /* Stop timer */
-    end_time = mysecond();
-
-    /* Calculate average time per operation in useconds */
-    times[i] = (end_time - start_time) * 1e6 / ntimes;
-
-    /* Calculate bandwidth using valid size */
-    bandwidths[i] = calculate_bw(valid_size, times[i]);
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, bandwidths, "bw", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(bandwidths);
 }
 
 /**
-  @brief Run the bidirectional bandwidth benchmark for shmem_put
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief One ping-pong round trip of shmem_put with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
  */
-void bench_shmem_put_bibw(int min_msg_size, int max_msg_size, int ntimes) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-  int peer = (mype == 0) ? 1 : 0;
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *bandwidths;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &bandwidths);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
-
-    /* Source and destination arrays for the shmem_put */
-    long *source = (long *)shmem_malloc(elem_count * sizeof(long));
-    long *dest = (long *)shmem_malloc(elem_count * sizeof(long));
-
-    /* Initialize source buffer */
-    for (int j = 0; j < elem_count; j++) {
-      source[j] = j;
-    }
-
-    /* Initialize start and end time */
-    double start_time, end_time;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Start timer */
-    start_time = mysecond();
-
-    /* Perform ntimes bidirectional shmem_puts */
-    for (int j = 0; j < ntimes; j++) {
-#if defined(USE_14) || defined(USE_15)
-      shmem_put(dest, source, elem_count, peer); /* each PE sends to other PE */
-      shmem_fence(); /* ensure ordering of puts */
-#endif
-    }
-    shmem_quiet();
-
-    /* Stop timer */
-    end_time = mysecond();
-
-    /* Calculate average time per operation in useconds */
-    times[i] = (end_time - start_time) * 1e6 / (ntimes);
-
-    /* Calculate bidirectional bandwidth using valid size */
-    bandwidths[i] = calculate_bibw(valid_size, times[i]);
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, bandwidths, "bibw", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(bandwidths);
+static inline void shmem_put_pingpong_issue(bench_ctx_t *ctx, int j) {
+  bench_pingpong(ctx, j, shmem_put_issue);
 }
 
-/*************************************************************
-  @brief Run the latency benchmark for shmem_put
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
- *************************************************************/
-void bench_shmem_put_latency(int min_msg_size, int max_msg_size, int ntimes) {
-  /* Check the number of PEs before doing anything */
-  if (!check_if_exactly_2_pes()) {
-    return;
-  }
-
-  int mype = shmem_my_pe();
-
-  /* Stuff that will be used throughout the benchmark */
-  int *msg_sizes;
-  double *times, *latencies;
-  int num_sizes = 0;
-
-  /* Setup the benchmark */
-  setup_bench(min_msg_size, max_msg_size, &num_sizes, &msg_sizes, &times,
-              &latencies);
-
-  /* Run the benchmark */
-  for (int i = 0, size = min_msg_size; size <= max_msg_size; size *= 2, i++) {
-    /* Validate the message size for the long datatype */
-    int valid_size = validate_typed_size(size, sizeof(long), "long");
-    msg_sizes[i] = valid_size;
-    
-    /* Calculate the number of elements based on the validated size */
-    int elem_count = calculate_elem_count(valid_size, sizeof(long));
-
-    /* Source and destination arrays for the shmem_put */
-    long *source = (long *)shmem_malloc(elem_count * sizeof(long));
-    long *dest = (long *)shmem_malloc(elem_count * sizeof(long));
-
-    /* Initialize source buffer */
-    for (int j = 0; j < elem_count; j++) {
-      source[j] = j;
-    }
-
-    /* Initialize total time */
-    double total_time = 0.0;
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Perform ntimes shmem_puts and accumulate total time */
-    if (mype == 0) {
-      for (int j = 0; j < ntimes; j++) {
-        double start_time = mysecond();
 #if defined(USE_14) || defined(USE_15)
-        shmem_put(dest, source, elem_count, 1);
-        shmem_quiet();
+/* Typed variants (see --type): shmem_TYPENAME_put of every standard RMA
+   type, shmem_putSIZE of every fixed size and shmem_putmem */
+#define SHMEM_PUT_TYPED(name, type, routine)                                   \
+  static inline void shmem_put_##name##_issue(bench_ctx_t *ctx, int j) {       \
+    (void)j;                                                                   \
+    shmem_##name##_put((type *)ctx->dest, (const type *)ctx->source,           \
+                       ctx->elem_count, ctx->peer);                            \
+  }                                                                            \
+  BENCH_DEFINE_TYPED_OPS(bench_shmem_put_##name,                               \
+                         "shmem_" #name "_put", #name, #type,                  \
+                         sizeof(type), false, NULL,                            \
+                         shmem_put_##name##_issue);
+#define SHMEM_PUT_SIZED(bits, bytes, routine)                                  \
+  static inline void shmem_put_##bits##_issue(bench_ctx_t *ctx, int j) {       \
+    (void)j;                                                                   \
+    shmem_put##bits(ctx->dest, ctx->source, ctx->elem_count, ctx->peer);       \
+  }                                                                            \
+  BENCH_DEFINE_TYPED_OPS(bench_shmem_put_##bits, "shmem_put" #bits,            \
+                         #bits, #bits "-bit", bytes, false,                    \
+                         NULL, shmem_put_##bits##_issue);
+
+BENCH_RMA_TYPES(SHMEM_PUT_TYPED, shmem_put)
+BENCH_SIZED_TYPES(SHMEM_PUT_SIZED, shmem_put)
+
+static const bench_op_t *const shmem_put_bw_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_BW, shmem_put)
+    BENCH_SIZED_TYPES(BENCH_TYPED_ENTRY_BW, shmem_put)
+    &bench_shmem_putmem_bw,
+    NULL};
+
+static const bench_op_t *const shmem_put_bibw_types[] = {
+    BENCH_RMA_TYPES(BENCH_TYPED_ENTRY_BIBW, shmem_put)
+    BENCH_SIZED_TYPES(BENCH_TYPED_ENTRY_BIBW, shmem_put)
+    &bench_shmem_putmem_bibw,
+    NULL};
+#else
+#define shmem_put_bw_types NULL
+#define shmem_put_bibw_types NULL
 #endif
-        double end_time = mysecond();
-        total_time += (end_time - start_time) * 1e6;
-      }
-    }
 
-    /* Calculate average latency per operation in microseconds */
-    times[i] = total_time / ntimes;
-
-    /* Record latency */
-    latencies[i] = times[i];
-
-    /* Sync PEs */
-    shmem_barrier_all();
-
-    /* Free the buffers */
-    shmem_free(source);
-    shmem_free(dest);
-  }
-
-  /* Display results */
-  shmem_barrier_all();
-  if (mype == 0) {
-    display_results(times, msg_sizes, latencies, "latency", num_sizes);
-  }
-  shmem_barrier_all();
-
-  /* Free memory */
-  free(msg_sizes);
-  free(times);
-  free(latencies);
-}
+/* PE 0 puts to PE 1 */
+BENCH_DEFINE_OP(bench_shmem_put_bw,
+                .benchmark = "shmem_put",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .issue = shmem_put_issue,
+                .typed = shmem_put_bw_types);
+
+/* Both PEs put to each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_put_bibw,
+                .benchmark = "shmem_put",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .issue = shmem_put_issue,
+                .typed = shmem_put_bibw_types);
+
+/* PE 0 and PE 1 put back and forth, each waiting for the other's flag;
+   half the round trip is reported */
+BENCH_DEFINE_OP(bench_shmem_put_latency,
+                .benchmark = "shmem_put",
+                .benchtype = "latency",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_COLLECTIVE,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .transfers = 2,
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_pingpong_issue,
+                .complete = bench_complete_none);
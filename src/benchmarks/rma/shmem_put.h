@@ -15,17 +15,18 @@
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_put
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
+  @brief Bandwidth benchmark for shmem_put
  */
-void bench_shmem_put_bw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_put_bw;
 
 /**
-  @brief Run the bidirectional bandwidth benchmark for shmem_put
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
+  @brief Bidirectional bandwidth benchmark for shmem_put
  */
-void bench_shmem_put_bibw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_put_bibw;
+
+/**
+  @brief Ping-pong latency benchmark for shmem_put (half round trip)
+ */
+extern const bench_op_t bench_shmem_put_latency;
 
 #endif /* SHMEM_PUT_H */
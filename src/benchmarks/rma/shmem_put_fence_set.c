@@ -0,0 +1,111 @@
+/**
+  @file shmem_put_fence_set.c
+  @brief Source file for shmem_put_fence_set benchmarks with support for
+  OpenSHMEM 1.4 and 1.5
+  Baseline for the put-with-signal benchmarks: shmem_put, shmem_fence and
+  shmem_long_atomic_set of a flag
+*/
+
+#include "shmem_put_fence_set.h"
+
+/**
+  @brief Put msg_size bytes of longs to the peer, fence, and set its flag
+  to seq with an atomic: the sequence shmem_put_signal replaces
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+  @param seq Flag value
+ */
+static inline void shmem_put_fence_set_send(bench_ctx_t *ctx, int j,
+                                            long seq) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  shmem_put((long *)ctx->dest, (const long *)ctx->source, ctx->elem_count,
+            ctx->peer);
+  shmem_fence();
+  shmem_long_atomic_set(ctx->flag, seq, ctx->peer);
+#endif
+}
+
+/**
+  @brief Issue one put + fence + atomic set with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_put_fence_set_issue(bench_ctx_t *ctx, int j) {
+  shmem_put_fence_set_send(ctx, j, ++ctx->seq);
+}
+
+/**
+  @brief Wait until the peer has set this PE's flag to seq
+  @param ctx Benchmark state
+  @param seq Flag value to wait for
+ */
+static inline void shmem_put_fence_set_wait(bench_ctx_t *ctx, long seq) {
+#if defined(USE_14) || defined(USE_15)
+  shmem_long_wait_until(ctx->flag, SHMEM_CMP_EQ, seq);
+#endif
+}
+
+/**
+  @brief One ping-pong round trip of put + fence + atomic set with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_put_fence_set_pingpong_issue(bench_ctx_t *ctx,
+                                                      int j) {
+  bench_roundtrip(ctx, j, shmem_put_fence_set_send,
+                  shmem_put_fence_set_wait);
+}
+
+/* PE 0 puts and sets a flag on PE 1 */
+BENCH_DEFINE_OP(bench_shmem_put_fence_set_bw,
+                .benchmark = "shmem_put_fence_set",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_fence_set_issue);
+
+/* Both PEs put and set a flag on each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_put_fence_set_bibw,
+                .benchmark = "shmem_put_fence_set",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_fence_set_issue);
+
+/* PE 0 and PE 1 put back and forth, each waiting for the flag with
+   shmem_long_wait_until; half the round trip is reported */
+BENCH_DEFINE_OP(bench_shmem_put_fence_set_latency,
+                .benchmark = "shmem_put_fence_set",
+                .benchtype = "latency",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_COLLECTIVE,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .transfers = 2,
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_fence_set_pingpong_issue,
+                .complete = bench_complete_none);
+
+/* PE 0 puts and sets a flag on PE 1 in windows of back-to-back operations, one
+   shmem_quiet per window */
+BENCH_DEFINE_OP(bench_shmem_put_fence_set_mr,
+                .benchmark = "shmem_put_fence_set",
+                .benchtype = "mr",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .complete_at = BENCH_COMPLETE_WINDOW,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_fence_set_issue);
@@ -0,0 +1,38 @@
+/**
+  @file shmem_put_fence_set.h
+  @brief Header file for shmem_put_fence_set benchmarks with support for
+  OpenSHMEM 1.4 and 1.5
+*/
+
+#ifndef SHMEM_PUT_FENCE_SET_H
+#define SHMEM_PUT_FENCE_SET_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/**
+  @brief Bandwidth benchmark for shmem_put_fence_set
+ */
+extern const bench_op_t bench_shmem_put_fence_set_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark for shmem_put_fence_set
+ */
+extern const bench_op_t bench_shmem_put_fence_set_bibw;
+
+/**
+  @brief Ping-pong latency (half round trip) benchmark for shmem_put_fence_set
+ */
+extern const bench_op_t bench_shmem_put_fence_set_latency;
+
+/**
+  @brief Windowed message-rate (see --window) benchmark for shmem_put_fence_set
+ */
+extern const bench_op_t bench_shmem_put_fence_set_mr;
+
+#endif /* SHMEM_PUT_FENCE_SET_H */
@@ -0,0 +1,38 @@
+/**
+  @file shmem_put_signal.h
+  @brief Header file for shmem_put_signal benchmarks with support for
+  OpenSHMEM 1.5
+*/
+
+#ifndef SHMEM_PUT_SIGNAL_H
+#define SHMEM_PUT_SIGNAL_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/**
+  @brief Bandwidth benchmark for shmem_put_signal
+ */
+extern const bench_op_t bench_shmem_put_signal_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark for shmem_put_signal
+ */
+extern const bench_op_t bench_shmem_put_signal_bibw;
+
+/**
+  @brief Ping-pong latency (half round trip) benchmark for shmem_put_signal
+ */
+extern const bench_op_t bench_shmem_put_signal_latency;
+
+/**
+  @brief Windowed message-rate (see --window) benchmark for shmem_put_signal
+ */
+extern const bench_op_t bench_shmem_put_signal_mr;
+
+#endif /* SHMEM_PUT_SIGNAL_H */
@@ -0,0 +1,125 @@
+/**
+  @file shmem_put_signal_nbi.c
+  @brief Source file for shmem_put_signal_nbi benchmarks with support for
+  OpenSHMEM 1.5
+*/
+
+#include "shmem_put_signal_nbi.h"
+
+#if defined(USE_15)
+/**
+  @brief Put msg_size bytes of longs to the peer and set its signal to seq
+  in the same call
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+  @param seq Signal value
+ */
+static inline void shmem_put_signal_nbi_send(bench_ctx_t *ctx, int j,
+                                             long seq) {
+  (void)j;
+  shmem_long_put_signal_nbi((long *)ctx->dest, (const long *)ctx->source,
+                            ctx->elem_count, ctx->signal, (uint64_t)seq,
+                            SHMEM_SIGNAL_SET, ctx->peer);
+}
+
+/**
+  @brief Issue one shmem_put_signal_nbi with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_put_signal_nbi_issue(bench_ctx_t *ctx, int j) {
+  shmem_put_signal_nbi_send(ctx, j, ++ctx->seq);
+}
+
+/**
+  @brief Wait until the peer has set this PE's signal to seq
+  @param ctx Benchmark state
+  @param seq Signal value to wait for
+ */
+static inline void shmem_put_signal_nbi_wait(bench_ctx_t *ctx, long seq) {
+  shmem_signal_wait_until(ctx->signal, SHMEM_CMP_EQ, (uint64_t)seq);
+}
+
+/**
+  @brief One ping-pong round trip of shmem_put_signal_nbi with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_put_signal_nbi_pingpong_issue(bench_ctx_t *ctx,
+                                                       int j) {
+  bench_roundtrip(ctx, j, shmem_put_signal_nbi_send,
+                  shmem_put_signal_nbi_wait);
+}
+#else
+/* Not provided by OpenSHMEM 1.4 */
+#define shmem_put_signal_nbi_issue NULL
+#define shmem_put_signal_nbi_pingpong_issue NULL
+#endif
+
+/* PE 0 puts with a signal to PE 1 */
+BENCH_DEFINE_OP(bench_shmem_put_signal_nbi_bw,
+                .benchmark = "shmem_put_signal_nbi",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_signal_nbi_issue);
+
+/* Both PEs put with a signal to each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_put_signal_nbi_bibw,
+                .benchmark = "shmem_put_signal_nbi",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_signal_nbi_issue);
+
+/* PE 0 and PE 1 put back and forth, each waiting for the signal with
+   shmem_signal_wait_until; half the round trip is reported */
+BENCH_DEFINE_OP(bench_shmem_put_signal_nbi_latency,
+                .benchmark = "shmem_put_signal_nbi",
+                .benchtype = "latency",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_COLLECTIVE,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .transfers = 2,
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_signal_nbi_pingpong_issue,
+                .complete = bench_complete_none);
+
+/* PE 0 puts with a signal to PE 1 in windows of back-to-back operations, one
+   shmem_quiet per window */
+BENCH_DEFINE_OP(bench_shmem_put_signal_nbi_mr,
+                .benchmark = "shmem_put_signal_nbi",
+                .benchtype = "mr",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .complete_at = BENCH_COMPLETE_WINDOW,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_signal_nbi_issue);
+
+/* PE 0 puts with a signal to PE 1, computing between issue and shmem_quiet
+   of every operation for as long as the transfer alone takes */
+BENCH_DEFINE_OP(bench_shmem_put_signal_nbi_overlap,
+                .benchmark = "shmem_put_signal_nbi",
+                .benchtype = "overlap",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .complete_at = BENCH_COMPLETE_EACH,
+                .sized = true,
+                .overlap = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_flags,
+                .issue = shmem_put_signal_nbi_issue);
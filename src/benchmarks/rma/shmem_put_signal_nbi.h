@@ -0,0 +1,43 @@
+/**
+  @file shmem_put_signal_nbi.h
+  @brief Header file for shmem_put_signal_nbi benchmarks with support for
+  OpenSHMEM 1.5
+*/
+
+#ifndef SHMEM_PUT_SIGNAL_NBI_H
+#define SHMEM_PUT_SIGNAL_NBI_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/**
+  @brief Bandwidth benchmark for shmem_put_signal_nbi
+ */
+extern const bench_op_t bench_shmem_put_signal_nbi_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark for shmem_put_signal_nbi
+ */
+extern const bench_op_t bench_shmem_put_signal_nbi_bibw;
+
+/**
+  @brief Ping-pong latency (half round trip) benchmark for shmem_put_signal_nbi
+ */
+extern const bench_op_t bench_shmem_put_signal_nbi_latency;
+
+/**
+  @brief Windowed message-rate (see --window) benchmark for shmem_put_signal_nbi
+ */
+extern const bench_op_t bench_shmem_put_signal_nbi_mr;
+
+/**
+  @brief Communication/computation overlap benchmark for shmem_put_signal_nbi
+ */
+extern const bench_op_t bench_shmem_put_signal_nbi_overlap;
+
+#endif /* SHMEM_PUT_SIGNAL_NBI_H */
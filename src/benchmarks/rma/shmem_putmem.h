@@ -15,17 +15,24 @@
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_putmem
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
+  @brief Bandwidth benchmark for shmem_putmem
  */
-void bench_shmem_putmem_bw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_putmem_bw;
 
 /**
-  @brief Run the bidirectional bandwidth benchmark for shmem_putmem
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
+  @brief Bidirectional bandwidth benchmark for shmem_putmem
  */
-void bench_shmem_putmem_bibw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_putmem_bibw;
+
+/**
+  @brief Ping-pong latency benchmark for shmem_putmem (half round trip)
+ */
+extern const bench_op_t bench_shmem_putmem_latency;
+
+/**
+  @brief Alignment sweep of shmem_putmem: bandwidth at every source and
+  destination offset of bench_align_offsets against offset 0
+ */
+extern const bench_op_t bench_shmem_putmem_align;
 
 #endif /* SHMEM_PUTMEM_H */
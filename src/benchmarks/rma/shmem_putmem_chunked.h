@@ -0,0 +1,29 @@
+/**
+  @file shmem_putmem_chunked.h
+  @author Michael Beebe (Texas Tech University)
+*/
+
+#ifndef SHMEM_PUTMEM_CHUNKED_H
+#define SHMEM_PUTMEM_CHUNKED_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/**
+  @brief Bandwidth benchmark of one transfer split into --chunks
+  shmem_putmem_nbi pieces in flight at once
+ */
+extern const bench_op_t bench_shmem_putmem_chunked_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark of one transfer split into
+  --chunks shmem_putmem_nbi pieces in flight at once
+ */
+extern const bench_op_t bench_shmem_putmem_chunked_bibw;
+
+#endif /* SHMEM_PUTMEM_CHUNKED_H */
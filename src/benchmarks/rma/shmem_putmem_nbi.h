@@ -15,19 +15,24 @@
 #include "shmembench.h"
 
 /**
-  @brief Run the bandwidth benchmark for shmem_putmem_nbi
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Bandwidth benchmark for shmem_putmem_nbi
  */
-void bench_shmem_putmem_nbi_bw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_putmem_nbi_bw;
 
 /**
-  @brief Run the bidirectional bandwidth benchmark for shmem_putmem_nbi
-  @param min_msg_size Minimum message size for test in bytes
-  @param max_msg_size Maximum message size for test in bytes
-  @param ntimes Number of repetitions to get the avgs from
+  @brief Bidirectional bandwidth benchmark for shmem_putmem_nbi
  */
-void bench_shmem_putmem_nbi_bibw(int min_msg_size, int max_msg_size, int ntimes);
+extern const bench_op_t bench_shmem_putmem_nbi_bibw;
+
+/**
+  @brief Windowed message-rate benchmark for shmem_putmem_nbi (see --window)
+ */
+extern const bench_op_t bench_shmem_putmem_nbi_mr;
+
+/**
+  @brief Alignment sweep of shmem_putmem_nbi: bandwidth at every source and
+  destination offset of bench_align_offsets against offset 0
+ */
+extern const bench_op_t bench_shmem_putmem_nbi_align;
 
 #endif /* SHMEM_PUTMEM_NBI_H */
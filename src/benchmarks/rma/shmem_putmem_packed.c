@@ -0,0 +1,51 @@
+/**
+  @file shmem_putmem_packed.c
+  @brief Source file for shmem_putmem_packed benchmarks with support for
+  OpenSHMEM 1.4 and 1.5
+  The pack-then-contiguous alternative to shmem_iput: the strided elements
+  are gathered into a staging buffer and sent with one shmem_putmem
+*/
+
+#include "shmem_putmem_packed.h"
+
+/**
+  @brief Pack elem_count longs strided by --stride and put them to the peer
+  as one contiguous shmem_putmem, leaving the same data at the peer as
+  shmem_iput
+  @param ctx Benchmark state prepared by bench_prepare_staged
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_putmem_packed_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+  pack_strided_longs((long *)ctx->staging, (const long *)ctx->source,
+                     ctx->stride, ctx->elem_count);
+#if defined(USE_14) || defined(USE_15)
+  shmem_putmem(ctx->dest, ctx->staging, ctx->msg_size, ctx->peer);
+#endif
+}
+
+/* PE 0 packs and puts to PE 1 */
+BENCH_DEFINE_OP(bench_shmem_putmem_packed_bw,
+                .benchmark = "shmem_putmem_packed",
+                .benchtype = "bw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_PE0,
+                .sized = true,
+                .uses_stride = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_staged,
+                .issue = shmem_putmem_packed_issue);
+
+/* Both PEs pack and put to each other at the same time */
+BENCH_DEFINE_OP(bench_shmem_putmem_packed_bibw,
+                .benchmark = "shmem_putmem_packed",
+                .benchtype = "bibw",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .uses_stride = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .prepare = bench_prepare_staged,
+                .issue = shmem_putmem_packed_issue);
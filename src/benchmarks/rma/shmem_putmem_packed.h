@@ -0,0 +1,29 @@
+/**
+  @file shmem_putmem_packed.h
+  @brief Header file for shmem_putmem_packed benchmarks with support for
+  OpenSHMEM 1.4 and 1.5
+*/
+
+#ifndef SHMEM_PUTMEM_PACKED_H
+#define SHMEM_PUTMEM_PACKED_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pack.h"
+#include "shmembench.h"
+
+/**
+  @brief Bandwidth benchmark for shmem_putmem_packed
+ */
+extern const bench_op_t bench_shmem_putmem_packed_bw;
+
+/**
+  @brief Bidirectional bandwidth benchmark for shmem_putmem_packed
+ */
+extern const bench_op_t bench_shmem_putmem_packed_bibw;
+
+#endif /* SHMEM_PUTMEM_PACKED_H */
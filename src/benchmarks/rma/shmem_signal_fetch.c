@@ -0,0 +1,61 @@
+/**
+  @file shmem_signal_fetch.c
+  @brief Source file for shmem_signal_fetch benchmarks with support for
+  OpenSHMEM 1.5
+*/
+
+#include "shmem_signal_fetch.h"
+
+#if defined(USE_15)
+/**
+  @brief Put msg_size bytes of longs to the peer and set its signal to seq
+  in the same call
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+  @param seq Signal value
+ */
+static inline void shmem_signal_fetch_send(bench_ctx_t *ctx, int j, long seq) {
+  (void)j;
+  shmem_long_put_signal((long *)ctx->dest, (const long *)ctx->source,
+                        ctx->elem_count, ctx->signal, (uint64_t)seq,
+                        SHMEM_SIGNAL_SET, ctx->peer);
+}
+
+/**
+  @brief Poll this PE's signal with shmem_signal_fetch until the peer has
+  set it to seq
+  @param ctx Benchmark state
+  @param seq Signal value to wait for
+ */
+static inline void shmem_signal_fetch_wait(bench_ctx_t *ctx, long seq) {
+  while (shmem_signal_fetch(ctx->signal) != (uint64_t)seq) {
+  }
+}
+
+/**
+  @brief One ping-pong round trip of shmem_signal_fetch with the peer
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_signal_fetch_pingpong_issue(bench_ctx_t *ctx, int j) {
+  bench_roundtrip(ctx, j, shmem_signal_fetch_send, shmem_signal_fetch_wait);
+}
+#else
+/* Not provided by OpenSHMEM 1.4 */
+#define shmem_signal_fetch_pingpong_issue NULL
+#endif
+
+/* PE 0 and PE 1 shmem_put_signal back and forth, each polling for the
+   signal with shmem_signal_fetch; half the round trip is reported */
+BENCH_DEFINE_OP(bench_shmem_signal_fetch_latency,
+                .benchmark = "shmem_signal_fetch",
+                .benchtype = "latency",
+                .pes = BENCH_EXACTLY_2_PES,
+                .issuers = BENCH_ISSUE_COLLECTIVE,
+                .sized = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .transfers = 2,
+                .prepare = bench_prepare_flags,
+                .issue = shmem_signal_fetch_pingpong_issue,
+                .complete = bench_complete_none);
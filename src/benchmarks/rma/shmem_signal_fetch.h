@@ -0,0 +1,23 @@
+/**
+  @file shmem_signal_fetch.h
+  @brief Header file for shmem_signal_fetch benchmarks with support for
+  OpenSHMEM 1.5
+*/
+
+#ifndef SHMEM_SIGNAL_FETCH_H
+#define SHMEM_SIGNAL_FETCH_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/**
+  @brief Ping-pong latency (half round trip) benchmark for shmem_signal_fetch
+ */
+extern const bench_op_t bench_shmem_signal_fetch_latency;
+
+#endif /* SHMEM_SIGNAL_FETCH_H */
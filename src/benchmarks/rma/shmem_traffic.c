@@ -0,0 +1,119 @@
+/**
+  @file shmem_traffic.c
+  @brief Source file for the random-access RMA traffic benchmarks with
+  support for OpenSHMEM 1.4 and 1.5
+  Every PE reads and writes slots of the region of other PEs, the target
+  PE, slot and direction of each access drawn from the --traffic
+  distribution and --rw-ratio mix before the timed loop. Writes put from
+  source to the target's dest, reads get from the target's source to dest.
+*/
+
+#include "shmem_traffic.h"
+
+/**
+  @brief Get the region of the current size and precompute the accesses
+  of this PE into it. Cold rings are not used: the accesses already spread
+  over the whole region.
+  @param ctx Benchmark state; msg_size is the bytes of one access, the
+  access cursor starts over
+ */
+static void shmem_traffic_prepare(bench_ctx_t *ctx) {
+  ctx->ring_bytes = 0;
+  size_t slots = BENCH_TRAFFIC_SPAN / ctx->msg_size;
+  if (slots == 0) {
+    slots = 1;
+  }
+  size_t max_bytes = ctx->max_msg_size > BENCH_TRAFFIC_SPAN
+                         ? ctx->max_msg_size
+                         : BENCH_TRAFFIC_SPAN;
+  bench_prepare_buffers(ctx, slots * ctx->msg_size, max_bytes);
+
+  if (ctx->accesses == NULL) {
+    ctx->accesses = (traffic_access_t *)malloc(BENCH_ACCESSES *
+                                               sizeof(traffic_access_t));
+  }
+  if (ctx->accesses == NULL ||
+      !traffic_generate(ctx->accesses, BENCH_ACCESSES, ctx->traffic,
+                        bench_zipf, bench_traffic_reads,
+                        bench_traffic_writes, ctx->mype, ctx->npes, slots,
+                        ctx->msg_size)) {
+    fprintf(stderr, "PE %d: Unable to allocate the traffic accesses\n",
+            ctx->mype);
+    shmem_global_exit(1);
+  }
+  ctx->access_next = 0;
+}
+
+/**
+  @brief Prepare the single-long accesses of shmem_long_p and shmem_long_g
+  @param ctx Benchmark state; msg_size and elem_count are set
+ */
+static void shmem_traffic_pg_prepare(bench_ctx_t *ctx) {
+  ctx->msg_size = sizeof(long);
+  ctx->elem_count = 1;
+  ctx->max_msg_size = sizeof(long);
+  shmem_traffic_prepare(ctx);
+}
+
+/**
+  @brief Issue the next access with shmem_putmem_nbi or shmem_getmem_nbi
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_traffic_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  const traffic_access_t *a = bench_access(ctx);
+  char *dest = (char *)ctx->dest + a->offset;
+  char *source = (char *)ctx->source + a->offset;
+  if (a->write) {
+    shmem_putmem_nbi(dest, source, ctx->msg_size, a->pe);
+  } else {
+    shmem_getmem_nbi(dest, source, ctx->msg_size, a->pe);
+  }
+#endif
+}
+
+/**
+  @brief Issue the next access with shmem_long_p or shmem_long_g
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+ */
+static inline void shmem_traffic_pg_issue(bench_ctx_t *ctx, int j) {
+  (void)j;
+#if defined(USE_14) || defined(USE_15)
+  const traffic_access_t *a = bench_access(ctx);
+  long *dest = (long *)((char *)ctx->dest + a->offset);
+  const long *source = (const long *)((char *)ctx->source + a->offset);
+  if (a->write) {
+    shmem_long_p(dest, *source, a->pe);
+  } else {
+    *dest = shmem_long_g(source, a->pe);
+  }
+#endif
+}
+
+/* Every PE issues its accesses back to back, one shmem_quiet per batch */
+BENCH_DEFINE_OP(bench_shmem_traffic_updates,
+                .benchmark = "shmem_traffic",
+                .benchtype = "updates",
+                .pes = BENCH_ATLEAST_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .sized = true,
+                .uses_traffic = true,
+                .prepare = shmem_traffic_prepare,
+                .issue = shmem_traffic_issue);
+
+/* The same with single longs; shmem_long_g returns only once the value
+   is back, shmem_long_p completes with the batch */
+BENCH_DEFINE_OP(bench_shmem_traffic_pg_updates,
+                .benchmark = "shmem_traffic_pg",
+                .benchtype = "updates",
+                .pes = BENCH_ATLEAST_2_PES,
+                .issuers = BENCH_ISSUE_ALL,
+                .uses_traffic = true,
+                .elem_size = sizeof(long),
+                .elem_name = "long",
+                .op_name = "Update",
+                .prepare = shmem_traffic_pg_prepare,
+                .issue = shmem_traffic_pg_issue);
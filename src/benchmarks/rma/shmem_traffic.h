@@ -0,0 +1,35 @@
+/**
+  @file shmem_traffic.h
+  @brief Header file for the random-access RMA traffic benchmarks with
+  support for OpenSHMEM 1.4 and 1.5
+*/
+
+#ifndef SHMEM_TRAFFIC_H
+#define SHMEM_TRAFFIC_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "shmembench.h"
+
+/* Bytes of the region every PE exposes to the accesses of the others; it
+   holds as many slots of the message size as fit (at least one) */
+#define BENCH_TRAFFIC_SPAN ((size_t)4 << 20)
+
+/**
+  @brief Updates per second of shmem_putmem_nbi and shmem_getmem_nbi from
+  every PE, to the PEs and offsets of --traffic in the --rw-ratio mix
+ */
+extern const bench_op_t bench_shmem_traffic_updates;
+
+/**
+  @brief Updates per second of shmem_long_p and shmem_long_g from every PE,
+  to the PEs and offsets of --traffic in the --rw-ratio mix
+ */
+extern const bench_op_t bench_shmem_traffic_pg_updates;
+
+#endif /* SHMEM_TRAFFIC_H */
@@ -0,0 +1,83 @@
+/**
+  @file bufpool.c
+  @brief Symmetric buffer pool shared by the message-size sweeps
+*/
+
+#include "bufpool.h"
+
+/* Allocation mode of the current sweep (see --realloc-per-size) */
+static bool bufpool_realloc = false;
+
+/* One symmetric buffer per slot and the bytes it can hold */
+static struct {
+  void *buf;
+  size_t capacity;
+} bufpool[BUFPOOL_SLOTS];
+
+/**
+  @brief Select how benchmark buffers are allocated for the next sweep
+  @param realloc_per_size True to shmem_malloc/shmem_free the buffers at
+  every message size (old behavior, includes registration effects), false
+  to allocate each buffer once at the largest size and reuse it
+ */
+void bufpool_init(bool realloc_per_size) {
+  bufpool_realloc = realloc_per_size;
+  memset(bufpool, 0, sizeof(bufpool));
+}
+
+/**
+  @brief Get a symmetric buffer for the current message size.
+  Collective: all PEs must make the same calls in the same order. In pooled
+  mode the slot is allocated once with room for max_bytes and its leading
+  bytes are handed out for every size.
+  @param slot Index of the buffer within the benchmark (0..BUFPOOL_SLOTS-1)
+  @param bytes Bytes needed at the current message size
+  @param max_bytes Bytes needed at the largest message size of the sweep
+  @return Pointer to at least bytes of symmetric memory
+ */
+void *bufpool_alloc(int slot, size_t bytes, size_t max_bytes) {
+  void *buf = NULL;
+
+  if (bufpool_realloc) {
+    buf = shmem_malloc(bytes);
+  } else if (slot >= 0 && slot < BUFPOOL_SLOTS) {
+    /* Only (re)allocate when the slot is empty or too small */
+    if (bufpool[slot].buf == NULL || bufpool[slot].capacity < bytes) {
+      size_t capacity = (max_bytes > bytes) ? max_bytes : bytes;
+      shmem_free(bufpool[slot].buf);
+      bufpool[slot].buf = shmem_align(BUFPOOL_ALIGN, capacity);
+      bufpool[slot].capacity = (bufpool[slot].buf != NULL) ? capacity : 0;
+    }
+    buf = bufpool[slot].buf;
+  }
+
+  if (buf == NULL) {
+    fprintf(stderr, "PE %d: Unable to allocate %zu bytes of symmetric memory\n",
+            shmem_my_pe(), bytes);
+    shmem_global_exit(1);
+  }
+  return buf;
+}
+
+/**
+  @brief Give back a buffer at the end of a message size.
+  Frees it in --realloc-per-size mode, keeps it for the next size otherwise.
+  @param buf Buffer returned by bufpool_alloc
+ */
+void bufpool_release(void *buf) {
+  if (bufpool_realloc) {
+    shmem_free(buf);
+  }
+}
+
+/**
+  @brief Free every pooled buffer at the end of a sweep (collective)
+ */
+void bufpool_finalize(void) {
+  for (int i = 0; i < BUFPOOL_SLOTS; i++) {
+    if (bufpool[i].buf != NULL) {
+      shmem_free(bufpool[i].buf);
+    }
+  }
+  memset(bufpool, 0, sizeof(bufpool));
+}
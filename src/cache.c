@@ -0,0 +1,189 @@
+/**
+  @file cache.c
+  @brief Cache eviction of the cold-cache mode (see --cache)
+*/
+
+#include "cache.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define CACHE_X86 1
+#endif
+
+/* Buffer streamed through to push everything else out of the caches where
+   no flush instruction is available (allocated on first use) */
+static volatile unsigned char *cache_evict_buf = NULL;
+static size_t cache_evict_size = 0;
+
+/**
+  @brief Parse a sysfs cache size such as "32768K"
+  @param text Size as sysfs reports it
+  @return Bytes, or 0 if unreadable
+ */
+static long cache_parse_size(const char *text) {
+  char *end;
+  long size = strtol(text, &end, 10);
+  if (end == text || size <= 0) {
+    return 0;
+  }
+  if (*end == 'K') {
+    size <<= 10;
+  } else if (*end == 'M') {
+    size <<= 20;
+  } else if (*end == 'G') {
+    size <<= 30;
+  }
+  return size;
+}
+
+/**
+  @brief Get the size of the largest cache of this CPU, from sysconf or
+  sysfs
+  @return Bytes of the last-level cache, or CACHE_DEFAULT_LLC if unknown
+ */
+long cache_llc_bytes(void) {
+  long size = 0;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+  size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+  if (size <= 0) {
+    size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  }
+#endif
+
+  /* sysfs lists every cache of the CPU; the largest is the last level */
+  for (int index = 0; size <= 0 && index < 8; index++) {
+    char path[64];
+    char text[32];
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+      continue;
+    }
+    if (fgets(text, sizeof(text), f) != NULL) {
+      long bytes = cache_parse_size(text);
+      size = (bytes > size) ? bytes : size;
+    }
+    fclose(f);
+  }
+
+  return (size > 0) ? size : CACHE_DEFAULT_LLC;
+}
+
+#if defined(CACHE_X86)
+/**
+  @brief Check whether this CPU has clflushopt
+  @return True if it does
+ */
+static bool cache_has_clflushopt(void) {
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    return false;
+  }
+  return (ebx & bit_CLFLUSHOPT) != 0;
+}
+
+/**
+  @brief Flush a buffer with clflushopt, whose flushes of different lines
+  overlap (cache_evict_wait waits for them)
+  @param p First cache line of the buffer
+  @param end End of the buffer
+ */
+__attribute__((target("clflushopt"))) static void
+cache_flush_opt(const char *p, const char *end) {
+  for (; p < end; p += CACHE_LINE) {
+    _mm_clflushopt((void *)p);
+  }
+}
+
+/**
+  @brief Flush a buffer with clflush, which every x86-64 CPU has
+  @param p First cache line of the buffer
+  @param end End of the buffer
+ */
+static void cache_flush(const char *p, const char *end) {
+  for (; p < end; p += CACHE_LINE) {
+    _mm_clflush(p);
+  }
+}
+#else
+/**
+  @brief Stream through an eviction buffer twice the size of the last-level
+  cache, pushing everything else out
+ */
+static void cache_evict_all(void) {
+  if (cache_evict_buf == NULL) {
+    cache_evict_size = (size_t)cache_llc_bytes() * 2;
+    cache_evict_buf = (volatile unsigned char *)malloc(cache_evict_size);
+    if (cache_evict_buf == NULL) {
+      fprintf(stderr, "Unable to allocate the cache eviction buffer\n");
+      cache_evict_size = 0;
+      return;
+    }
+  }
+  for (size_t i = 0; i < cache_evict_size; i += CACHE_LINE) {
+    cache_evict_buf[i]++;
+  }
+}
+#endif
+
+/**
+  @brief Start evicting every cache line of a buffer from all cache levels
+  (see cache_evict_wait)
+  @param buf Start of the buffer
+  @param bytes Bytes of the buffer
+ */
+void cache_evict(const void *buf, size_t bytes) {
+#if defined(CACHE_X86)
+  static int opt = -1;
+  if (opt < 0) {
+    opt = cache_has_clflushopt();
+  }
+  const char *p =
+      (const char *)((uintptr_t)buf & ~(uintptr_t)(CACHE_LINE - 1));
+  const char *end = (const char *)buf + bytes;
+  if (opt) {
+    cache_flush_opt(p, end);
+  } else {
+    cache_flush(p, end);
+  }
+#else
+  /* The eviction buffer clears everything at once in cache_evict_wait */
+  (void)buf;
+  (void)bytes;
+#endif
+}
+
+/**
+  @brief Finish the evictions started by cache_evict: fence the flushes on
+  x86, touch the eviction buffer elsewhere
+ */
+void cache_evict_wait(void) {
+#if defined(CACHE_X86)
+  _mm_mfence();
+#else
+  cache_evict_all();
+#endif
+}
+
+/**
+  @brief Get how cache_evict evicts on this CPU
+  @return "clflushopt", "clflush" or "eviction buffer"
+ */
+const char *cache_evict_method(void) {
+#if defined(CACHE_X86)
+  return cache_has_clflushopt() ? "clflushopt" : "clflush";
+#else
+  return "eviction buffer";
+#endif
+}
+
+/**
+  @brief Free the eviction buffer, if one was used
+ */
+void cache_finalize(void) {
+  free((void *)cache_evict_buf);
+  cache_evict_buf = NULL;
+  cache_evict_size = 0;
+}
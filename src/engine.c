@@ -0,0 +1,661 @@
+/**
+  @file engine.c
+  @brief Table-driven measurement engine shared by every benchmark
+*/
+
+#include "shmembench.h"
+
+/* Compute iterations per microsecond of this PE, calibrated once per
+   overlap benchmark */
+static double bench_compute_rate = 0.0;
+
+/* Both sides are shifted together: within a word, across a word, and to
+   just before and at the next cache line */
+const int bench_align_offsets[BENCH_ALIGN_OFFSETS] = {
+    0, 1, 2, 4, 8, 16, 32, 63, 64};
+
+/**
+  @brief Round a buffer up to whole cache lines, the distance between the
+  ring copies of a cold run
+  @param bytes Bytes of one copy
+  @return Bytes from one copy to the next
+ */
+static size_t bench_ring_span(size_t bytes) {
+  return (bytes + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+}
+
+/**
+  @brief Get a source and destination buffer from the pool and fill the
+  source with a byte pattern. Cold runs get ring copies of both spanning
+  more than ctx->ring_bytes.
+  @param ctx Benchmark state; source, dest, ring and ring_span are set
+  @param bytes Bytes of each buffer at the current size
+  @param max_bytes Bytes of each buffer at the largest size
+ */
+void bench_prepare_buffers(bench_ctx_t *ctx, size_t bytes, size_t max_bytes) {
+  ctx->ring = 1;
+  ctx->ring_span = bytes;
+  if (ctx->ring_bytes > 0) {
+    /* At least two copies, and one more than fit in ring_bytes, so the
+       pool slots hold every size at ring_bytes plus two copies */
+    ctx->ring_span = bench_ring_span(bytes);
+    size_t copies = ctx->ring_bytes / ctx->ring_span + 1;
+    ctx->ring = (copies > 2) ? (int)copies : 2;
+    bytes = ctx->ring_span * ctx->ring;
+    max_bytes = ctx->ring_bytes + 2 * bench_ring_span(max_bytes);
+  }
+  ctx->source = bufpool_alloc(0, bytes, max_bytes);
+  ctx->dest = bufpool_alloc(1, bytes, max_bytes);
+
+  unsigned char *source = (unsigned char *)ctx->source;
+  for (size_t j = 0; j < bytes; j++) {
+    source[j] = (unsigned char)(ctx->mype + j);
+  }
+}
+
+/**
+  @brief Get a source and destination of one long per PE from the pool, as
+  used by the atomics (each PE works on its own element)
+  @param ctx Benchmark state; source and dest are set
+ */
+void bench_prepare_scalars(bench_ctx_t *ctx) {
+  size_t bytes = (size_t)ctx->npes * sizeof(long);
+  bench_prepare_buffers(ctx, bytes, bytes);
+  memset(ctx->dest, 0, bytes);
+}
+
+/**
+  @brief Get msg_size byte buffers plus a cleared arrival flag and signal
+  for ops that notify their peer, then wait for every PE so nothing is set
+  before it was cleared
+  @param ctx Benchmark state; source, dest, flag, signal and seq are set
+ */
+void bench_prepare_flags(bench_ctx_t *ctx) {
+  bench_prepare_buffers(ctx, ctx->msg_size, ctx->max_msg_size);
+  ctx->flag = (long *)bufpool_alloc(2, sizeof(long), sizeof(long));
+  ctx->signal =
+      (uint64_t *)bufpool_alloc(3, sizeof(uint64_t), sizeof(uint64_t));
+  *ctx->flag = 0;
+  *ctx->signal = 0;
+  ctx->seq = 0;
+  shmem_barrier_all();
+}
+
+/**
+  @brief Get buffers of one element of any standard RMA type plus a cleared
+  arrival flag and signal, for the single-element ops (shmem_p, shmem_g and
+  the one-element put and get they are compared against)
+  @param ctx Benchmark state; msg_size, elem_count, source, dest, flag,
+  signal and seq are set
+ */
+void bench_prepare_element(bench_ctx_t *ctx) {
+  ctx->msg_size = BENCH_ELEMENT_BYTES;
+  ctx->elem_count = 1;
+  if (ctx->max_msg_size < BENCH_ELEMENT_BYTES) {
+    ctx->max_msg_size = BENCH_ELEMENT_BYTES;
+  }
+  bench_prepare_flags(ctx);
+}
+
+/**
+  @brief Get source and destination buffers with room for msg_size bytes
+  of elements spaced --stride elements apart
+  @param ctx Benchmark state; source and dest are set
+ */
+void bench_prepare_strided(bench_ctx_t *ctx) {
+  bench_prepare_buffers(ctx, ctx->msg_size * ctx->stride,
+                        ctx->max_msg_size * ctx->stride);
+}
+
+/**
+  @brief Get strided buffers plus a staging buffer of the same size for
+  ops that pack strided elements into a contiguous transfer
+  @param ctx Benchmark state; source, dest and staging are set
+ */
+void bench_prepare_staged(bench_ctx_t *ctx) {
+  bench_prepare_strided(ctx);
+  ctx->staging = bufpool_alloc(4, ctx->msg_size * ctx->stride,
+                               ctx->max_msg_size * ctx->stride);
+}
+
+/**
+  @brief Get source and destination buffers of msg_size bytes starting
+  src_offset and dst_offset bytes into their pool buffers
+  @param ctx Benchmark state; source and dest are set
+ */
+void bench_prepare_offset(bench_ctx_t *ctx) {
+  bench_prepare_buffers(ctx, ctx->msg_size + MAX_OFFSET,
+                        ctx->max_msg_size + MAX_OFFSET);
+  ctx->source = (char *)ctx->source + ctx->src_offset;
+  ctx->dest = (char *)ctx->dest + ctx->dst_offset;
+}
+
+/**
+  @brief Get source and destination buffers of msg_size bytes and map the
+  peer's destination into this PE with shmem_ptr
+  @param ctx Benchmark state; source, dest and remote are set
+ */
+void bench_prepare_direct(bench_ctx_t *ctx) {
+  bench_prepare_buffers(ctx, ctx->msg_size, ctx->max_msg_size);
+  ctx->remote = (ctx->peer >= 0) ? shmem_ptr(ctx->dest, ctx->peer) : NULL;
+}
+
+/**
+  @brief Check that the job has the number of PEs an op needs
+  @param op Op descriptor
+  @return True if the benchmark can run
+ */
+static bool bench_engine_check_pes(const bench_op_t *op) {
+  if (op->pes != BENCH_EXACTLY_2_PES) {
+    return check_if_atleast_2_pes();
+  }
+  if (!bench_multipair()) {
+    return check_if_exactly_2_pes();
+  }
+
+  /* --pairs runs point-to-point ops on every pair at once */
+  if (bench_pair_count() == 0) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr, RED_COLOR "\nERROR: " RESET_COLOR "No pairs of PEs "
+                              "could be formed for this test!\n\n");
+    }
+    return false;
+  }
+  return true;
+}
+
+/**
+  @brief Check whether this PE issues and times the operations of an op
+  @param op Op descriptor
+  @param ctx Benchmark state with the peer set
+  @return True if this PE is active
+ */
+static bool bench_engine_active(const bench_op_t *op, const bench_ctx_t *ctx) {
+  if (op->pes == BENCH_EXACTLY_2_PES) {
+    /* The lower PE of each pair drives one-sided transfers; PEs left out
+       of the pairs only keep the others in step */
+    if (ctx->peer < 0) {
+      return false;
+    }
+    return op->issuers != BENCH_ISSUE_PE0 || ctx->mype < ctx->peer;
+  }
+  return op->issuers != BENCH_ISSUE_PE0 || ctx->mype == 0;
+}
+
+/**
+  @brief Check whether --ordering applies to an op: the point-to-point
+  RMA transfers that complete through shmem_quiet. Ping-pong and signal
+  latency ops wait for delivery themselves, overlap ops time their own
+  completion and direct ops store around the library.
+  @param op Op descriptor
+  @return True if the op runs once per ordering semantic
+ */
+static bool bench_engine_orderable(const bench_op_t *op) {
+  return op->sized && op->pes == BENCH_EXACTLY_2_PES && !op->direct &&
+         !op->overlap && op->complete != bench_complete_none;
+}
+
+/**
+  @brief Get the bytes one operation moves at the current size
+  @param op Op descriptor
+  @param ctx Benchmark state at the row's message size
+  @return Bytes per operation
+ */
+static size_t bench_engine_bytes(const bench_op_t *op,
+                                 const bench_ctx_t *ctx) {
+  return (op->bytes != NULL) ? op->bytes(ctx) : ctx->msg_size;
+}
+
+/**
+  @brief Compute the result column of one row from the time per operation
+  @param op Op descriptor
+  @param ctx Benchmark state at the row's message size
+  @param time Time per operation in microseconds
+  @return Bandwidth in MB/s, or the latency in microseconds
+ */
+static double bench_engine_result(const bench_op_t *op,
+                                  const bench_ctx_t *ctx, double time) {
+  size_t bytes = bench_engine_bytes(op, ctx);
+
+  if (strcmp(op->benchtype, "bibw") == 0) {
+    return calculate_bibw(bytes, time);
+  } else if (strcmp(op->benchtype, "bw") == 0 ||
+             strcmp(op->benchtype, "mr") == 0 ||
+             strcmp(op->benchtype, "pack") == 0 ||
+             strcmp(op->benchtype, "align") == 0 ||
+             strcmp(op->benchtype, "rma") == 0) {
+    return calculate_bw(bytes, time);
+  }
+  return calculate_latency(time);
+}
+
+/**
+  @brief Calibrate the compute loop of the overlap benchtype: double the
+  iterations until one run takes BENCH_COMPUTE_CALIBRATION seconds
+  @return Compute iterations per microsecond on this PE
+ */
+static double bench_engine_calibrate_compute(void) {
+  long iters = 1024;
+  double elapsed;
+  for (;;) {
+    double start = mysecond();
+    bench_compute(iters);
+    elapsed = mysecond() - start;
+    if (elapsed >= BENCH_COMPUTE_CALIBRATION || iters >= (1L << 40)) {
+      break;
+    }
+    iters *= 2;
+  }
+  return (elapsed > 0.0) ? iters / (elapsed * 1e6) : 0.0;
+}
+
+/**
+  @brief Time the compute loop alone, as overlap ops run it once per
+  operation
+  @param iters Compute iterations per operation
+  @param ops Number of operations
+  @return Compute time per operation in microseconds
+ */
+static double bench_engine_compute_time(long iters, int ops) {
+  double start = mysecond();
+  for (int j = 0; j < ops; j++) {
+    bench_compute(iters);
+  }
+  return (ops > 0) ? (mysecond() - start) * 1e6 / ops : 0.0;
+}
+
+/**
+  @brief Run the untimed warmup of one row on this PE. The windows of
+  collective ops end in an agreement of all PEs, so PEs left out of the
+  pairs still take part in every round without running operations.
+  @param op Op descriptor
+  @param ctx Benchmark state of the row
+  @param active True if this PE issues the op's operations
+  @param per_batch Operations per warmup operation (the window of windowed
+  ops, else 1)
+ */
+static void bench_engine_warmup(const bench_op_t *op, bench_ctx_t *ctx,
+                                bool active, int per_batch) {
+  bool collective = op->issuers == BENCH_ISSUE_COLLECTIVE;
+  if (!active && !collective) {
+    return;
+  }
+  int n;
+  bench_warmup_begin(collective);
+  while ((n = bench_warmup_next()) > 0) {
+    bench_warmup_end_window(active ? op->loop(ctx, n * per_batch) : 0.0);
+  }
+}
+
+/**
+  @brief Evict the ring copies the next batch of a cold run will use from
+  every cache level, before the batch is timed. The peer's copies are
+  evicted by the peer.
+  @param ctx Benchmark state with more than one ring copy
+  @param ops Operations in the batch
+ */
+static void bench_engine_evict(const bench_ctx_t *ctx, int ops) {
+  int copies = (ops < ctx->ring) ? ops : ctx->ring;
+  for (int k = 0; k < copies; k++) {
+    size_t at =
+        (size_t)((ctx->ring_next + k) % ctx->ring) * ctx->ring_span;
+    cache_evict((const char *)ctx->ring_source + at, ctx->ring_span);
+    cache_evict((const char *)ctx->ring_dest + at, ctx->ring_span);
+  }
+  cache_evict_wait();
+}
+
+/**
+  @brief Time batches of operations for one row until the mean is precise
+  enough. Must be called by all PEs.
+  @param op Op descriptor
+  @param ctx Benchmark state of the row
+  @param active True if this PE issues the operations
+  @param row Index of the row
+  @param ops Operations per batch
+  @param transfers One-way transfers per operation
+  @return Average time per one-way transfer in microseconds
+ */
+static double bench_engine_measure(const bench_op_t *op, bench_ctx_t *ctx,
+                                   bool active, int row, int ops,
+                                   int transfers) {
+  double elapsed;
+  bench_measure_begin();
+  do {
+    /* Cold runs move on to copies out of the cache, untimed */
+    if (ctx->ring > 1) {
+      bench_engine_evict(ctx, ops);
+    }
+
+    /* Sync PEs */
+    shmem_barrier_all();
+    elapsed = active ? op->loop(ctx, ops) : 0.0;
+    if (ctx->ring > 1) {
+      ctx->ring_next = (ctx->ring_next + ops) % ctx->ring;
+    }
+  } while (bench_measure_batch(elapsed, ops * transfers));
+
+  /* Calculate average time per operation in useconds */
+  return bench_measure_end(row);
+}
+
+/**
+  @brief Measure every row of one sweep: warmup, timed batches and the
+  cross-PE summary for each message size (or the single row)
+  @param op Op descriptor
+  @param ctx Benchmark state; msg_size, elem_count and the buffers are set
+  per row
+  @param num_rows Number of rows of the size schedule
+  @param ntimes Operations per timed batch, or windows for windowed ops
+  @param msg_sizes Rounded message size of each row, or NULL for size-less
+  ops
+  @param times Time per operation of each row in microseconds, or NULL for
+  size-less ops
+  @param results Result column of each row, or NULL for size-less ops
+  @return Number of rows measured: sizes that round to the size of the
+  row before (several sizes below one element) are measured once
+ */
+static int bench_engine_sweep(const bench_op_t *op, bench_ctx_t *ctx,
+                              int num_rows, int ntimes, size_t *msg_sizes,
+                              double *times, double *results) {
+  /* PEs that do not issue operations only keep the others in step */
+  bool active = bench_engine_active(op, ctx);
+  bool multipair = op->pes == BENCH_EXACTLY_2_PES && bench_multipair();
+
+  /* A windowed batch is ntimes windows of operations */
+  int per_batch =
+      (bench_complete_where(op, ctx) == BENCH_COMPLETE_WINDOW) ? ctx->window
+                                                                : 1;
+  int ops = ntimes * per_batch;
+
+  /* Times are reported per one-way transfer (half a ping-pong round trip) */
+  int transfers = (op->transfers > 1) ? op->transfers : 1;
+
+  int rows = 0;
+  for (int k = 0; k < num_rows; k++) {
+    if (op->sized) {
+      /* Round the message size to whole elements of the op's datatype */
+      ctx->msg_size = bench_sizes.sizes[k];
+      if (op->elem_size > 1) {
+        ctx->msg_size =
+            validate_typed_size(ctx->msg_size, op->elem_size, op->elem_name);
+        ctx->elem_count = calculate_elem_count(ctx->msg_size, op->elem_size);
+      } else {
+        ctx->elem_count = ctx->msg_size;
+      }
+      if (rows > 0 && ctx->msg_size == msg_sizes[rows - 1]) {
+        continue;
+      }
+    }
+    int i = rows++;
+
+    /* Buffers for this size */
+    if (op->prepare != NULL) {
+      op->prepare(ctx);
+    } else if (op->sized) {
+      bench_prepare_buffers(ctx, ctx->msg_size, ctx->max_msg_size);
+    }
+    ctx->ring_source = ctx->source;
+    ctx->ring_dest = ctx->dest;
+    ctx->ring_remote = ctx->remote;
+    ctx->ring_next = 0;
+
+    /* Ops compared side by side time the alternative first, on the same
+       buffers, so the row keeps the op's own iterations and samples */
+    double compare = 0.0;
+    if (op->compare != NULL) {
+      bench_engine_warmup(op->compare, ctx, active, per_batch);
+      compare =
+          bench_engine_measure(op->compare, ctx, active, i, ops, transfers);
+    }
+
+    /* Untimed warmup */
+    bench_engine_warmup(op, ctx, active, per_batch);
+
+    /* Time batches of operations until the mean is precise enough */
+    double time = bench_engine_measure(op, ctx, active, i, ops, transfers);
+    if (op->compare != NULL) {
+      bench_compare_commit(i, compare,
+                           bench_engine_result(op->compare, ctx, compare));
+    }
+
+    /* Overlap ops then put as much compute between issue and completion as
+       the transfer alone took, and time the sequence again */
+    double overlap = 0.0;
+    if (op->overlap) {
+      double pure = time;
+      double compute = 0.0;
+      ctx->compute = 0;
+      if (active) {
+        /* The calibrated rate only gets close; rescale once against the
+           compute loop timed the way the batch runs it */
+        ctx->compute = (long)(pure * bench_compute_rate);
+        compute = bench_engine_compute_time(ctx->compute, ops);
+        if (compute > 0.0) {
+          ctx->compute = (long)(ctx->compute * pure / compute);
+          compute = bench_engine_compute_time(ctx->compute, ops);
+        }
+      }
+      time = bench_engine_measure(op, ctx, active, i, ops, transfers);
+      ctx->compute = 0;
+      overlap = bench_overlap_commit(i, pure, compute, time);
+    }
+
+    /* Summarize the per-operation samples for this row */
+    bench_sample_commit(i, transfers);
+
+    /* Gather every PE's time for the cross-PE summary */
+    bench_aggregate_times(i, time, active);
+
+    if (op->sized) {
+      msg_sizes[i] = ctx->msg_size;
+      if (op->overlap) {
+        times[i] = time;
+        results[i] = overlap;
+      } else if (multipair) {
+        /* Average over the active PEs, bandwidth summed over the pairs */
+        times[i] = bench_pe_row(i)->avg;
+        results[i] = (strcmp(op->benchtype, "latency") == 0)
+                         ? times[i]
+                         : bench_pair_commit(i, bench_engine_bytes(op, ctx));
+      } else {
+        times[i] = time;
+        results[i] = bench_engine_result(op, ctx, time);
+      }
+    }
+
+    /* Sync PEs */
+    shmem_barrier_all();
+
+    /* Free the buffers */
+    bufpool_release((char *)ctx->ring_source - ctx->src_offset);
+    bufpool_release((char *)ctx->ring_dest - ctx->dst_offset);
+    if (ctx->flag != NULL) {
+      bufpool_release(ctx->flag);
+      bufpool_release(ctx->signal);
+    }
+    if (ctx->staging != NULL) {
+      bufpool_release(ctx->staging);
+    }
+    ctx->source = ctx->dest = ctx->staging = ctx->remote = NULL;
+    ctx->flag = NULL;
+    ctx->signal = NULL;
+  }
+  return rows;
+}
+
+/**
+  @brief Run one benchmark: warmup, timed batches and the cross-PE summary
+  for every message size (or a single row), then report the results. Ops
+  completed per window repeat this for every --window, strided ops for
+  every --stride and align ops for every offset of bench_align_offsets.
+  Must be called by all PEs.
+  @param op Op descriptor of the benchmark
+  @param max_msg_size Largest message size of the sweep in bytes
+  @param ntimes Operations per timed batch
+ */
+void bench_engine_run(const bench_op_t *op, size_t max_msg_size,
+                      int ntimes) {
+  /* Check the number of PEs before doing anything */
+  if (!bench_engine_check_pes(op)) {
+    return;
+  }
+  if (op->issue == NULL) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr, "%s is not supported by this OpenSHMEM version!\n",
+              op->benchmark);
+    }
+    return;
+  }
+
+  bench_ctx_t ctx;
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.mype = shmem_my_pe();
+  ctx.npes = shmem_n_pes();
+  if (op->pes == BENCH_EXACTLY_2_PES && bench_multipair()) {
+    ctx.peer = bench_pair_peer();
+  } else {
+    ctx.peer = (ctx.mype == 0) ? 1 : 0;
+  }
+  ctx.max_msg_size = max_msg_size;
+  ctx.ring_bytes = op->sized ? bench_cache_ring : 0;
+
+  /* Direct ops store into the peer's memory, which only PEs that share it
+     (usually those on the same node) can do */
+  if (op->direct && !bench_ptr_reachable(ctx.peer)) {
+    if (ctx.mype == 0) {
+      fprintf(stderr,
+              "%s needs every peer to be reachable through shmem_ptr "
+              "(PEs on the same node), skipping!\n",
+              op->benchmark);
+    }
+    return;
+  }
+  if (op->sized && op->elem_size > max_msg_size) {
+    /* Sizes below one element are rounded up to one */
+    ctx.max_msg_size = op->elem_size;
+  }
+
+  /* Random targets are drawn up front, outside the timed loop */
+  ctx.targets = (int *)malloc(BENCH_TARGETS * sizeof(int));
+  if (ctx.targets == NULL) {
+    fprintf(stderr, "PE %d: Unable to allocate target PEs\n", ctx.mype);
+    shmem_global_exit(1);
+  }
+  for (int j = 0; j < BENCH_TARGETS; j++) {
+    ctx.targets[j] = rand() % ctx.npes;
+  }
+
+#if defined(USE_14)
+  /* Setup pSync array */
+  if (op->psync_size > 0) {
+    ctx.psync = (long *)shmem_malloc(op->psync_size * sizeof(long));
+    if (ctx.psync == NULL) {
+      fprintf(stderr, "PE %d: shmem_malloc failed\n", ctx.mype);
+      shmem_global_exit(1);
+    }
+    for (size_t j = 0; j < op->psync_size; j++) {
+      ctx.psync[j] = SHMEM_SYNC_VALUE;
+    }
+    shmem_barrier_all();
+  }
+#endif
+
+  /* The compute loop of overlap ops runs at this PE's own speed */
+  if (op->overlap) {
+    bench_compute_rate = bench_engine_calibrate_compute();
+  }
+
+  /* Stuff that will be used throughout the benchmark */
+  size_t *msg_sizes = NULL;
+  double *times = NULL, *results = NULL;
+  int num_rows = 1;
+  if (op->sized && !setup_bench(&num_rows, &msg_sizes, &times, &results)) {
+    num_rows = 0;
+  }
+  int rows = num_rows; /* Rows left once duplicate sizes are dropped */
+
+  /* Point-to-point RMA ops run everything below once per --ordering */
+  bool ordered = bench_num_orderings > 0 && bench_engine_orderable(op);
+  int orderings = ordered ? bench_num_orderings : 1;
+  bool align = strcmp(op->benchtype, "align") == 0;
+
+  for (int o = 0; o < orderings && num_rows > 0; o++) {
+    ctx.ordered = ordered;
+    ctx.ordering = ordered ? bench_orderings[o] : ORDERING_NONE;
+
+    /* Windowed ops run one sweep per --window, strided ops one per
+       --stride, chunked ops one per --chunks, traffic ops one per
+       --traffic, align ops one per offset and the others a single sweep */
+    bool windowed = bench_complete_where(op, &ctx) == BENCH_COMPLETE_WINDOW;
+    int passes = windowed           ? bench_num_windows
+                 : op->uses_stride  ? bench_num_strides
+                 : op->uses_chunks  ? bench_num_chunks
+                 : op->uses_traffic ? bench_num_traffic
+                 : align            ? BENCH_ALIGN_OFFSETS
+                                    : 1;
+
+    for (int w = 0; w < passes; w++) {
+      ctx.window = windowed ? bench_windows[w] : 0;
+      ctx.stride = op->uses_stride ? bench_strides[w] : 0;
+      ctx.chunks = op->uses_chunks ? bench_chunks[w] : 0;
+      ctx.traffic = op->uses_traffic ? bench_traffic[w] : TRAFFIC_UNIFORM;
+      ctx.src_offset = align             ? bench_align_offsets[w]
+                       : op->uses_offset ? bench_src_offset
+                                         : 0;
+      ctx.dst_offset = align             ? bench_align_offsets[w]
+                       : op->uses_offset ? bench_dst_offset
+                                         : 0;
+      rows = bench_engine_sweep(op, &ctx, num_rows, ntimes, msg_sizes, times,
+                                results);
+      for (int i = 0; i < rows; i++) {
+        if (align) {
+          bench_align_commit(w, i, results[i]);
+        }
+        /* The cost of each semantic is taken from its first sweep */
+        if (ordered && w == 0) {
+          bench_ordering_commit(o, i, times[i]);
+        }
+      }
+
+      /* Display results */
+      shmem_barrier_all();
+      if (ctx.mype == 0) {
+        const char *traffic =
+            op->uses_traffic ? traffic_name(ctx.traffic) : NULL;
+        if (op->sized) {
+          display_results(times, msg_sizes, results, op->benchtype,
+                          rows, ctx.window, ctx.chunks, ctx.stride,
+                          ctx.src_offset, ctx.dst_offset,
+                          ordered ? ordering_name(ctx.ordering) : NULL,
+                          traffic);
+        } else {
+          display_latency_results(op->op_name, traffic);
+        }
+      }
+      shmem_barrier_all();
+    }
+  }
+
+  /* Several orderings end with the time per operation of each */
+  if (ordered && orderings > 1 && rows > 0 && ctx.mype == 0) {
+    display_ordering_results(msg_sizes, rows, bench_orderings,
+                             orderings);
+  }
+
+  /* Align ops end with the penalty of every offset at every size */
+  if (align && rows > 0 && ctx.mype == 0) {
+    display_align_results(msg_sizes, rows);
+  }
+
+#if defined(USE_14)
+  shmem_free(ctx.psync);
+#endif
+
+  /* Free memory */
+  free(ctx.targets);
+  free(ctx.accesses);
+  free(msg_sizes);
+  free(times);
+  free(results);
+}
@@ -8,16 +8,29 @@
 #define BENCHMARK_H
 
 /* RMA benchmarks */
+#include "../benchmarks/rma/shmem_chase.h"
+#include "../benchmarks/rma/shmem_g.h"
 #include "../benchmarks/rma/shmem_get.h"
 #include "../benchmarks/rma/shmem_getmem.h"
 #include "../benchmarks/rma/shmem_get_nbi.h"
 #include "../benchmarks/rma/shmem_getmem_nbi.h"
+#include "../benchmarks/rma/shmem_getmem_chunked.h"
+#include "../benchmarks/rma/shmem_getmem_unpacked.h"
 #include "../benchmarks/rma/shmem_iget.h"
 #include "../benchmarks/rma/shmem_iput.h"
+#include "../benchmarks/rma/shmem_p.h"
 #include "../benchmarks/rma/shmem_put.h"
 #include "../benchmarks/rma/shmem_putmem.h"
+#include "../benchmarks/rma/shmem_put_fence_set.h"
 #include "../benchmarks/rma/shmem_put_nbi.h"
+#include "../benchmarks/rma/shmem_ptr.h"
+#include "../benchmarks/rma/shmem_put_signal.h"
+#include "../benchmarks/rma/shmem_put_signal_nbi.h"
 #include "../benchmarks/rma/shmem_putmem_nbi.h"
+#include "../benchmarks/rma/shmem_putmem_chunked.h"
+#include "../benchmarks/rma/shmem_putmem_packed.h"
+#include "../benchmarks/rma/shmem_signal_fetch.h"
+#include "../benchmarks/rma/shmem_traffic.h"
 
 /* Collective benchmarks */
 #include "../benchmarks/collectives/shmem_alltoall.h"
@@ -0,0 +1,54 @@
+/**
+  @file bufpool.h
+  @brief Symmetric buffer pool shared by the message-size sweeps
+*/
+
+#ifndef BUFPOOL_H
+#define BUFPOOL_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Buffers a single benchmark can hold at once (e.g. source and dest) */
+#define BUFPOOL_SLOTS 5
+
+/* Alignment of every pooled buffer, so each size starts on a fresh page */
+#define BUFPOOL_ALIGN 4096
+
+/**
+  @brief Select how benchmark buffers are allocated for the next sweep
+  @param realloc_per_size True to shmem_malloc/shmem_free the buffers at
+  every message size (old behavior, includes registration effects), false
+  to allocate each buffer once at the largest size and reuse it
+ */
+void bufpool_init(bool realloc_per_size);
+
+/**
+  @brief Get a symmetric buffer for the current message size.
+  Collective: all PEs must make the same calls in the same order. In pooled
+  mode the slot is allocated once with room for max_bytes and its leading
+  bytes are handed out for every size.
+  @param slot Index of the buffer within the benchmark (0..BUFPOOL_SLOTS-1)
+  @param bytes Bytes needed at the current message size
+  @param max_bytes Bytes needed at the largest message size of the sweep
+  @return Pointer to at least bytes of symmetric memory
+ */
+void *bufpool_alloc(int slot, size_t bytes, size_t max_bytes);
+
+/**
+  @brief Give back a buffer at the end of a message size.
+  Frees it in --realloc-per-size mode, keeps it for the next size otherwise.
+  @param buf Buffer returned by bufpool_alloc
+ */
+void bufpool_release(void *buf);
+
+/**
+  @brief Free every pooled buffer at the end of a sweep (collective)
+ */
+void bufpool_finalize(void);
+
+#endif /* BUFPOOL_H */
@@ -0,0 +1,56 @@
+/**
+  @file cache.h
+  @brief Cache eviction of the cold-cache mode (see --cache)
+*/
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Bytes of a cache line; cold runs start every buffer copy on its own */
+#define CACHE_LINE 64
+
+/* Last-level cache assumed when the system does not report one */
+#define CACHE_DEFAULT_LLC (32L << 20)
+
+/**
+  @brief Get the size of the largest cache of this CPU, from sysconf or
+  sysfs
+  @return Bytes of the last-level cache, or CACHE_DEFAULT_LLC if unknown
+ */
+long cache_llc_bytes(void);
+
+/**
+  @brief Start evicting every cache line of a buffer from all cache levels
+  (see cache_evict_wait)
+  @param buf Start of the buffer
+  @param bytes Bytes of the buffer
+ */
+void cache_evict(const void *buf, size_t bytes);
+
+/**
+  @brief Finish the evictions started by cache_evict: with clflushopt or
+  clflush on x86 it fences the flushes, elsewhere it touches an eviction
+  buffer twice the size of the last-level cache
+ */
+void cache_evict_wait(void);
+
+/**
+  @brief Get how cache_evict evicts on this CPU
+  @return "clflushopt", "clflush" or "eviction buffer"
+ */
+const char *cache_evict_method(void);
+
+/**
+  @brief Free the eviction buffer, if one was used
+ */
+void cache_finalize(void);
+
+#endif /* CACHE_H */
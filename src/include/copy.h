@@ -0,0 +1,172 @@
+/**
+  @file copy.h
+  @brief Copy kernels of the shmem_ptr benchmarks, which store straight
+  into a peer's memory instead of going through the library
+*/
+
+#ifndef COPY_H
+#define COPY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define COPY_STREAM_X86 1
+#endif
+
+/* A copy kernel: bytes from src to dst */
+typedef void (*copy_fn_t)(void *restrict dst, const void *restrict src,
+                          size_t bytes);
+
+/**
+  @brief Copy one long at a time through a volatile destination, so the
+  compiler can neither vectorize the loop nor turn it into a memcpy
+  @param dst Destination
+  @param src Source
+  @param bytes Bytes to copy
+ */
+static inline void copy_scalar(void *restrict dst, const void *restrict src,
+                               size_t bytes) {
+  volatile long *d = (volatile long *)dst;
+  const long *s = (const long *)src;
+  size_t count = bytes / sizeof(long);
+  for (size_t i = 0; i < count; i++) {
+    d[i] = s[i];
+  }
+
+  /* Bytes past the last whole long */
+  volatile unsigned char *dt = (volatile unsigned char *)dst;
+  const unsigned char *st = (const unsigned char *)src;
+  for (size_t i = count * sizeof(long); i < bytes; i++) {
+    dt[i] = st[i];
+  }
+}
+
+/**
+  @brief Copy with memcpy, the streaming copy of CPUs without
+  non-temporal stores
+  @param dst Destination
+  @param src Source
+  @param bytes Bytes to copy
+ */
+static inline void copy_memcpy(void *restrict dst, const void *restrict src,
+                               size_t bytes) {
+  memcpy(dst, src, bytes);
+}
+
+#if defined(COPY_STREAM_X86)
+/**
+  @brief Copy the bytes in front of the first align-byte boundary of dst,
+  as non-temporal stores must be aligned
+  @param dst Destination
+  @param src Source
+  @param bytes Bytes to copy in all
+  @param align Alignment of the vector stores (power of two)
+  @return Bytes copied
+ */
+static inline size_t copy_head(void *dst, const void *src, size_t bytes,
+                               size_t align) {
+  size_t head = (size_t)(-(uintptr_t)dst & (align - 1));
+  if (head > bytes) {
+    head = bytes;
+  }
+  memcpy(dst, src, head);
+  return head;
+}
+
+/**
+  @brief Copy with 64-byte AVX-512 non-temporal stores, bypassing the cache
+  so the copy does not evict the working set or read the lines it writes
+  @param dst Destination
+  @param src Source
+  @param bytes Bytes to copy
+ */
+__attribute__((target("avx512f"))) static inline void
+copy_stream_avx512(void *restrict dst, const void *restrict src,
+                   size_t bytes) {
+  char *d = (char *)dst;
+  const char *s = (const char *)src;
+  size_t i = copy_head(d, s, bytes, 64);
+  for (; i + 64 <= bytes; i += 64) {
+    __m512i v = _mm512_loadu_si512((const void *)(s + i));
+    _mm512_stream_si512((__m512i *)(d + i), v);
+  }
+  memcpy(d + i, s + i, bytes - i);
+}
+
+/**
+  @brief Copy with 32-byte AVX2 non-temporal stores
+  @param dst Destination
+  @param src Source
+  @param bytes Bytes to copy
+ */
+__attribute__((target("avx2"))) static inline void
+copy_stream_avx2(void *restrict dst, const void *restrict src, size_t bytes) {
+  char *d = (char *)dst;
+  const char *s = (const char *)src;
+  size_t i = copy_head(d, s, bytes, 32);
+  for (; i + 32 <= bytes; i += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(s + i));
+    _mm256_stream_si256((__m256i *)(d + i), v);
+  }
+  memcpy(d + i, s + i, bytes - i);
+}
+
+/**
+  @brief Copy with 16-byte SSE2 non-temporal stores, which every x86-64
+  CPU has
+  @param dst Destination
+  @param src Source
+  @param bytes Bytes to copy
+ */
+static inline void copy_stream_sse2(void *restrict dst,
+                                    const void *restrict src, size_t bytes) {
+  char *d = (char *)dst;
+  const char *s = (const char *)src;
+  size_t i = copy_head(d, s, bytes, 16);
+  for (; i + 16 <= bytes; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(s + i));
+    _mm_stream_si128((__m128i *)(d + i), v);
+  }
+  memcpy(d + i, s + i, bytes - i);
+}
+#endif
+
+/**
+  @brief Pick the widest non-temporal copy this CPU runs. The choice is
+  made at run time, so the binary need not be built for the machine.
+  @param isa Set to the name of the instruction set picked
+  @return Streaming copy kernel
+ */
+static inline copy_fn_t copy_stream_select(const char **isa) {
+#if defined(COPY_STREAM_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    *isa = "AVX-512";
+    return copy_stream_avx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    *isa = "AVX2";
+    return copy_stream_avx2;
+  }
+  *isa = "SSE2";
+  return copy_stream_sse2;
+#else
+  *isa = "memcpy";
+  return copy_memcpy;
+#endif
+}
+
+/**
+  @brief Order non-temporal stores before the stores that follow them;
+  they are weakly ordered and not covered by ordinary store ordering
+ */
+static inline void copy_stream_fence(void) {
+#if defined(COPY_STREAM_X86)
+  _mm_sfence();
+#endif
+}
+
+#endif /* COPY_H */
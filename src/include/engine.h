@@ -0,0 +1,474 @@
+/**
+  @file engine.h
+  @brief Table-driven measurement engine shared by every benchmark.
+  Included at the end of shmembench.h, after the sampling helpers the timed
+  loop uses.
+*/
+
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ordering.h"
+#include "traffic.h"
+#include "types.h"
+
+/* Random target PEs precomputed per benchmark so no rand() call lands in
+   the timed loop (power of two) */
+#define BENCH_TARGETS 1024
+
+/* Accesses of the traffic benchmarks precomputed per size, cycled through
+   by the timed loop (power of two) */
+#define BENCH_ACCESSES 4096
+
+/* Seconds the compute loop of the overlap benchtype is calibrated over */
+#define BENCH_COMPUTE_CALIBRATION 0.01
+
+/* Offsets in bytes the align benchtype sweeps (see bench_align_offsets) */
+#define BENCH_ALIGN_OFFSETS 9
+
+/* pSync length of an OpenSHMEM 1.4 collective; 1.5 uses teams instead */
+#if defined(USE_14)
+#define BENCH_PSYNC(size) (size)
+#else
+#define BENCH_PSYNC(size) 0
+#endif
+
+/**
+  @enum bench_pes_t
+  @brief Number of PEs a benchmark needs
+ */
+typedef enum {
+  BENCH_EXACTLY_2_PES, /* Point-to-point between PE 0 and PE 1, or between
+                          every pair of --pairs */
+  BENCH_ATLEAST_2_PES  /* Any number of PEs from 2 up */
+} bench_pes_t;
+
+/**
+  @enum bench_issuers_t
+  @brief PEs that issue the timed operations
+ */
+typedef enum {
+  BENCH_ISSUE_PE0,       /* PE 0 (with --pairs, the lower PE of every pair)
+                            drives a one-sided transfer to its peer */
+  BENCH_ISSUE_ALL,       /* Every PE issues operations independently */
+  BENCH_ISSUE_COLLECTIVE /* Every PE takes part in each operation */
+} bench_issuers_t;
+
+/**
+  @enum bench_complete_t
+  @brief Where the completion hook runs in the timed loop
+ */
+typedef enum {
+  BENCH_COMPLETE_BATCH, /* Once after every batch of operations */
+  BENCH_COMPLETE_EACH,  /* After every operation, timing its full latency */
+  BENCH_COMPLETE_WINDOW /* After every window of operations (see --window);
+                           a batch is ntimes windows */
+} bench_complete_t;
+
+/**
+  @struct bench_ctx_t
+  @brief State of one benchmark run handed to the hooks of its op
+ */
+typedef struct {
+  int mype;          /* This PE */
+  int npes;          /* Number of PEs */
+  int peer;          /* Target of one-sided operations (the other PE of 2,
+                        or the partner of --pairs; -1 if unpaired) */
+  size_t msg_size;   /* Bytes per operation at the current size */
+  size_t elem_count; /* Elements of the op's elem_size in msg_size */
+  size_t max_msg_size; /* Largest size of the sweep, for pool sizing */
+  int stride;        /* Stride of strided operations (see --stride) */
+  int window;        /* Operations per completion, for BENCH_COMPLETE_WINDOW */
+  int chunks;        /* Pieces one transfer of chunked ops is split into */
+  bool ordered;      /* --ordering replaces the op's own completion */
+  ordering_t ordering; /* Ordering semantic of the sweep, if ordered */
+  traffic_t traffic; /* Distribution of the sweep of traffic ops */
+  int src_offset;    /* Bytes source is shifted into its buffer */
+  int dst_offset;    /* Bytes dest is shifted into its buffer */
+  void *source;      /* Source buffer (pool slot 0) */
+  void *dest;        /* Destination buffer (pool slot 1) */
+  long *psync;       /* pSync of OpenSHMEM 1.4 collectives, or NULL */
+  int *targets;      /* BENCH_TARGETS random target PEs */
+  traffic_access_t *accesses; /* BENCH_ACCESSES accesses of traffic ops,
+                                 or NULL */
+  int access_next;   /* Access the next operation of a traffic op takes;
+                        runs on across batches and warmup */
+  long *flag;        /* Symmetric arrival flag of ping-pong ops (slot 2) */
+  uint64_t *signal;  /* Symmetric signal of put-with-signal ops (slot 3) */
+  void *staging;     /* Contiguous staging buffer of packed ops (slot 4) */
+  void *remote;      /* dest of the peer as shmem_ptr maps it into this PE,
+                        for direct ops (NULL if unreachable) */
+  long seq;          /* Last flag or signal value of ping-pong ops */
+  long chase;        /* Link to the next node of pointer-chasing ops */
+  long compute;      /* Compute iterations between issue and completion of
+                        overlap ops (0: none) */
+  size_t ring_bytes; /* Bytes the buffer copies of a cold run must exceed
+                        (see --cache), or 0 for a warm run */
+  int ring;          /* Copies of source and dest the operations rotate
+                        through (1: a warm run) */
+  size_t ring_span;  /* Bytes from one copy to the next */
+  long ring_next;    /* Copy the next timed batch starts at */
+  void *ring_source; /* First copy of source */
+  void *ring_dest;   /* First copy of dest */
+  void *ring_remote; /* First copy of remote, or NULL */
+} bench_ctx_t;
+
+typedef struct bench_op bench_op_t;
+
+/**
+  @struct bench_op
+  @brief Descriptor of one benchmark: what it needs and how to issue,
+  complete and account for one operation. Registered in benchmark_table.
+ */
+struct bench_op {
+  const char *benchmark;        /* e.g. "shmem_put" */
+  const char *benchtype;        /* "bw", "bibw", "mr", "latency",
+                                   "overlap", "pack", "align", "rma",
+                                   "chase" or "updates" */
+  bench_pes_t pes;              /* PE count required */
+  bench_issuers_t issuers;      /* PEs that issue and time operations */
+  bench_complete_t complete_at; /* Completion per batch or per operation */
+  bool sized;                   /* Sweeps message sizes (else one row) */
+  bool uses_stride;             /* Takes --stride */
+  bool uses_offset;             /* Takes --src-offset and --dst-offset */
+  bool uses_chunks;             /* Splits each transfer into --chunks pieces */
+  bool uses_traffic;            /* Targets the PEs and offsets of --traffic */
+  bool direct;                  /* Loads and stores through shmem_ptr, so
+                                   every peer must be reachable by it */
+  size_t elem_size;             /* Sizes are rounded to this (0 or 1: bytes) */
+  const char *elem_name;        /* Name of the element type, for warnings */
+  const char *op_name;          /* Noun for one operation of size-less output */
+  size_t psync_size;            /* pSync longs (see BENCH_PSYNC), or 0 */
+  int transfers;                /* One-way transfers per issued operation
+                                   (ping-pong: 2), reported per transfer;
+                                   0 means 1 */
+  bool overlap;                 /* Computes between issue and completion
+                                   (the "overlap" benchtype) */
+  const bench_op_t *compare;    /* Alternative timed on the same rows and
+                                   buffers and reported side by side (the
+                                   "pack" and "rma" benchtypes), or NULL */
+  const char *type;             /* Name --type selects a typed variant by
+                                   (e.g. "int", "64", "mem"), or NULL */
+  const bench_op_t *const *typed; /* NULL-terminated variants of the op for
+                                     every element type (see --type), or
+                                     NULL */
+
+  /* Get and fill the buffers of the current size; NULL gets a source and
+     destination of msg_size bytes (none for size-less ops) */
+  void (*prepare)(bench_ctx_t *ctx);
+  /* Issue operation number j; NULL if the library does not provide it */
+  void (*issue)(bench_ctx_t *ctx, int j);
+  /* Complete outstanding operations; NULL for shmem_quiet() */
+  void (*complete)(bench_ctx_t *ctx);
+  /* Bytes one operation moves for bandwidth; NULL for msg_size */
+  size_t (*bytes)(const bench_ctx_t *ctx);
+  /* Timed loop instantiated for this op by BENCH_DEFINE_OP */
+  double (*loop)(bench_ctx_t *ctx, int ntimes);
+};
+
+/**
+  @brief Get the precomputed random target PE of operation j
+  @param ctx Benchmark state
+  @param j Index of the operation in the batch
+  @return Target PE
+ */
+static inline int bench_target(const bench_ctx_t *ctx, int j) {
+  return ctx->targets[j & (BENCH_TARGETS - 1)];
+}
+
+/**
+  @brief Take the next precomputed access of a traffic op. The cursor runs
+  on from batch to batch, so every row cycles through all BENCH_ACCESSES
+  accesses instead of replaying the first ntimes of them.
+  @param ctx Benchmark state; access_next is advanced
+  @return Target PE, offset and direction of the access
+ */
+static inline const traffic_access_t *bench_access(bench_ctx_t *ctx) {
+  const traffic_access_t *a = &ctx->accesses[ctx->access_next];
+  ctx->access_next = (ctx->access_next + 1) & (BENCH_ACCESSES - 1);
+  return a;
+}
+
+/**
+  @brief Bytes of each piece of a chunked transfer: msg_size split into
+  ctx->chunks pieces, the last one taking what is left
+  @param ctx Benchmark state of a chunked op
+  @return Bytes per piece (at least 1)
+ */
+static inline size_t bench_chunk_bytes(const bench_ctx_t *ctx) {
+  size_t chunks = (size_t)(ctx->chunks > 0 ? ctx->chunks : 1);
+  size_t piece = (ctx->msg_size + chunks - 1) / chunks;
+  return piece > 0 ? piece : 1;
+}
+
+/**
+  @brief Point source, dest and remote at the copies operation j of a cold
+  run uses, so each operation finds its data out of the cache
+  @param ctx Benchmark state with more than one ring copy
+  @param j Index of the operation in the batch
+ */
+static inline void bench_ring_select(bench_ctx_t *ctx, int j) {
+  size_t at = (size_t)((ctx->ring_next + j) % ctx->ring) * ctx->ring_span;
+  ctx->source = (char *)ctx->ring_source + at;
+  ctx->dest = (char *)ctx->ring_dest + at;
+  if (ctx->ring_remote != NULL) {
+    ctx->remote = (char *)ctx->ring_remote + at;
+  }
+}
+
+/**
+  @brief One ping-pong round trip of a put: the initiator (lower PE) puts
+  the payload and raises the peer's flag behind a fence, the peer waits for
+  the flag and answers the same way, and the initiator waits for the answer.
+  Both sides therefore time delivery at the target, not local completion.
+  @param ctx Benchmark state prepared by bench_prepare_flags
+  @param j Index of the operation in the batch
+  @param put Issues the payload put of the op to ctx->peer
+ */
+static inline void bench_pingpong(bench_ctx_t *ctx, int j,
+                                  void (*put)(bench_ctx_t *ctx, int j)) {
+  long seq = ++ctx->seq;
+  if (ctx->mype < ctx->peer) {
+    put(ctx, j);
+    shmem_fence();
+    shmem_long_p(ctx->flag, seq, ctx->peer);
+    shmem_long_wait_until(ctx->flag, SHMEM_CMP_EQ, seq);
+  } else {
+    shmem_long_wait_until(ctx->flag, SHMEM_CMP_EQ, seq);
+    put(ctx, j);
+    shmem_fence();
+    shmem_long_p(ctx->flag, seq, ctx->peer);
+  }
+}
+
+/**
+  @brief One ping-pong round trip built from an op's own notification: the
+  initiator (lower PE) sends and waits for the answer, the peer waits and
+  answers
+  @param ctx Benchmark state prepared by bench_prepare_flags
+  @param j Index of the operation in the batch
+  @param send Delivers the payload and notifies ctx->peer with seq
+  @param wait Returns once this PE has been notified with seq
+ */
+static inline void bench_roundtrip(bench_ctx_t *ctx, int j,
+                                   void (*send)(bench_ctx_t *ctx, int j,
+                                                long seq),
+                                   void (*wait)(bench_ctx_t *ctx, long seq)) {
+  long seq = ++ctx->seq;
+  if (ctx->mype < ctx->peer) {
+    send(ctx, j, seq);
+    wait(ctx, seq);
+  } else {
+    wait(ctx, seq);
+    send(ctx, j, seq);
+  }
+}
+
+/**
+  @brief Busy the CPU without touching memory or the network, standing in
+  for the application work an overlap op hides its transfer behind
+  @param iters Iterations to run
+ */
+static inline void bench_compute(long iters) {
+  volatile double x = 1.0;
+  for (long k = 0; k < iters; k++) {
+    x = x * 0.999999 + 1e-6;
+  }
+}
+
+/**
+  @brief Completion hook of ops whose issue hook already waits for delivery
+  @param ctx Benchmark state
+ */
+static inline void bench_complete_none(bench_ctx_t *ctx) { (void)ctx; }
+
+/**
+  @brief Get where the timed loop completes operations: the op's own
+  completion, or the one the ordering semantic of the sweep implies
+  @param op Op descriptor
+  @param ctx Benchmark state
+  @return Completion of the timed loop
+ */
+static inline bench_complete_t bench_complete_where(const bench_op_t *op,
+                                                    const bench_ctx_t *ctx) {
+  if (!ctx->ordered) {
+    return op->complete_at;
+  }
+  switch (ctx->ordering) {
+  case ORDERING_QUIET_EACH:
+    return BENCH_COMPLETE_EACH;
+  case ORDERING_QUIET_WINDOW:
+    return BENCH_COMPLETE_WINDOW;
+  default:
+    return BENCH_COMPLETE_BATCH;
+  }
+}
+
+/**
+  @brief Run the completion hook of an op
+  @param op Op descriptor
+  @param ctx Benchmark state
+ */
+static inline void bench_engine_complete(const bench_op_t *op,
+                                         bench_ctx_t *ctx) {
+  if (op->complete != NULL) {
+    op->complete(ctx);
+  } else {
+    shmem_quiet();
+  }
+}
+
+/**
+  @brief Time one batch of operations on this PE.
+  The only timed loop of the suite. BENCH_DEFINE_OP instantiates it with a
+  constant op, so the compiler can inline the hooks into it.
+  @param op Op descriptor
+  @param ctx Benchmark state
+  @param ntimes Number of operations in the batch
+  @return Time taken by the batch, including completion, in seconds
+ */
+static inline double bench_engine_batch(const bench_op_t *op,
+                                        bench_ctx_t *ctx, int ntimes) {
+  if (op->issue == NULL) {
+    return 0.0;
+  }
+
+  /* A sample has to span the completion of its operation, so sampling
+     completes every operation on its own */
+  bench_complete_t complete_at =
+      bench_sampling ? BENCH_COMPLETE_EACH : bench_complete_where(op, ctx);
+  bool fence = ctx->ordered && ctx->ordering == ORDERING_FENCE_EACH;
+
+  double start_time = mysecond();
+  bench_sample_begin(start_time);
+
+  int pending = 0;
+  for (int j = 0; j < ntimes; j++) {
+    if (ctx->ring > 1) {
+      bench_ring_select(ctx, j);
+    }
+    op->issue(ctx, j);
+    if (op->overlap) {
+      bench_compute(ctx->compute);
+    }
+    if (fence) {
+      shmem_fence();
+    }
+    if (complete_at == BENCH_COMPLETE_EACH) {
+      bench_engine_complete(op, ctx);
+    } else if (complete_at == BENCH_COMPLETE_WINDOW &&
+               ++pending == ctx->window) {
+      bench_engine_complete(op, ctx);
+      pending = 0;
+    }
+    bench_sample_mark();
+  }
+  if (complete_at == BENCH_COMPLETE_BATCH || pending > 0) {
+    bench_engine_complete(op, ctx);
+  }
+
+  return mysecond() - start_time;
+}
+
+/**
+  @brief Define an op descriptor together with its own timed loop
+  @param var Name of the descriptor (declared extern in the op's header)
+  @param ... Designated initializers of the bench_op_t fields
+ */
+#define BENCH_DEFINE_OP(var, ...)                                              \
+  static double var##_loop(bench_ctx_t *ctx, int ntimes) {                     \
+    return bench_engine_batch(&var, ctx, ntimes);                              \
+  }                                                                            \
+  const bench_op_t var = {__VA_ARGS__, .loop = var##_loop}
+
+/**
+  @brief Get a source and destination buffer from the pool and fill the
+  source with a byte pattern. Cold runs get ring copies of both spanning
+  more than ctx->ring_bytes.
+  @param ctx Benchmark state; source, dest, ring and ring_span are set
+  @param bytes Bytes of each buffer at the current size
+  @param max_bytes Bytes of each buffer at the largest size
+ */
+void bench_prepare_buffers(bench_ctx_t *ctx, size_t bytes, size_t max_bytes);
+
+/**
+  @brief Get a source and destination of one long per PE from the pool, as
+  used by the atomics (each PE works on its own element)
+  @param ctx Benchmark state; source and dest are set
+ */
+void bench_prepare_scalars(bench_ctx_t *ctx);
+
+/**
+  @brief Get msg_size byte buffers plus a cleared arrival flag and signal
+  for ops that notify their peer, then wait for every PE so nothing is set
+  before it was cleared
+  @param ctx Benchmark state; source, dest, flag, signal and seq are set
+ */
+void bench_prepare_flags(bench_ctx_t *ctx);
+
+/* Bytes of the largest standard RMA type, the buffers of single-element
+   ops are sized for */
+#define BENCH_ELEMENT_BYTES sizeof(long double)
+
+/**
+  @brief Get buffers of one element of any standard RMA type plus a cleared
+  arrival flag and signal, for the single-element ops (shmem_p, shmem_g and
+  the one-element put and get they are compared against)
+  @param ctx Benchmark state; msg_size, elem_count, source, dest, flag,
+  signal and seq are set
+ */
+void bench_prepare_element(bench_ctx_t *ctx);
+
+/**
+  @brief Get source and destination buffers with room for msg_size bytes
+  of elements spaced --stride elements apart
+  @param ctx Benchmark state; source and dest are set
+ */
+void bench_prepare_strided(bench_ctx_t *ctx);
+
+/**
+  @brief Get strided buffers plus a staging buffer of the same size for
+  ops that pack strided elements into a contiguous transfer
+  @param ctx Benchmark state; source, dest and staging are set
+ */
+void bench_prepare_staged(bench_ctx_t *ctx);
+
+/**
+  @brief Get source and destination buffers of msg_size bytes starting
+  src_offset and dst_offset bytes into their pool buffers
+  @param ctx Benchmark state; source and dest are set
+ */
+void bench_prepare_offset(bench_ctx_t *ctx);
+
+/**
+  @brief Get source and destination buffers of msg_size bytes and map the
+  peer's destination into this PE with shmem_ptr
+  @param ctx Benchmark state; source, dest and remote are set
+ */
+void bench_prepare_direct(bench_ctx_t *ctx);
+
+/* Offsets in bytes the align benchtype misaligns both buffers by, one
+   sweep each; the first is 0, the aligned baseline */
+extern const int bench_align_offsets[BENCH_ALIGN_OFFSETS];
+
+/**
+  @brief Run one benchmark: warmup, timed batches and the cross-PE summary
+  for every message size (or a single row), then report the results. Ops
+  completed per window repeat this for every --window, strided ops for
+  every --stride, chunked ops for every --chunks and align ops for every
+  offset of bench_align_offsets. Point-to-point RMA ops repeat all of it
+  for every --ordering.
+  Must be called by all PEs.
+  @param op Op descriptor of the benchmark
+  @param max_msg_size Largest message size of the sweep in bytes
+  @param ntimes Operations per timed batch
+ */
+void bench_engine_run(const bench_op_t *op, size_t max_msg_size,
+                      int ntimes);
+
+#endif /* ENGINE_H */
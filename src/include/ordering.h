@@ -0,0 +1,56 @@
+/**
+  @file ordering.h
+  @brief Completion and ordering semantics the point-to-point RMA
+  benchmarks can be forced to (see --ordering)
+*/
+
+#ifndef ORDERING_H
+#define ORDERING_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Number of ordering semantics, and the most --ordering accepts */
+#define MAX_ORDERINGS 4
+
+/**
+  @enum ordering_t
+  @brief Where a timed loop orders or completes its operations
+ */
+typedef enum {
+  ORDERING_NONE,         /* One shmem_quiet at the end of the batch */
+  ORDERING_FENCE_EACH,   /* shmem_fence after every operation, one
+                            shmem_quiet at the end of the batch */
+  ORDERING_QUIET_EACH,   /* shmem_quiet after every operation */
+  ORDERING_QUIET_WINDOW  /* shmem_quiet after every --window operations */
+} ordering_t;
+
+/**
+  @brief Parse the name of an ordering semantic
+  @param name "none", "fence-per-op", "quiet-per-op" or "quiet-per-window"
+  @param ordering Parsed semantic
+  @return True if the name is known, false otherwise
+ */
+bool ordering_parse(const char *name, ordering_t *ordering);
+
+/**
+  @brief Parse a comma-separated list of ordering semantics
+  @param arg List to parse, e.g. "none,fence-per-op"
+  @param orderings Parsed semantics
+  @param max Most semantics the list may hold
+  @param count Number of semantics parsed
+  @return True if every name is known and the list is not too long
+ */
+bool ordering_parse_list(const char *arg, ordering_t *orderings, int max,
+                         int *count);
+
+/**
+  @brief Get the name of an ordering semantic
+  @param ordering Ordering semantic
+  @return Name as accepted by --ordering
+ */
+const char *ordering_name(ordering_t ordering);
+
+#endif /* ORDERING_H */
@@ -0,0 +1,49 @@
+/**
+  @file pack.h
+  @brief Gather kernel of the pack-then-contiguous strided benchmarks
+*/
+
+#ifndef PACK_H
+#define PACK_H
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+  @brief Gather count longs spaced stride elements apart into a contiguous
+  buffer. Unrolled four ways so the loads of neighbouring elements do not
+  wait on each other; a unit stride is a plain copy.
+  @param dst Contiguous destination of count longs
+  @param src First element of the strided source
+  @param stride Distance between source elements in longs
+  @param count Number of elements
+ */
+static inline void pack_strided_longs(long *restrict dst,
+                                      const long *restrict src, int stride,
+                                      size_t count) {
+  if (stride == 1) {
+    memcpy(dst, src, count * sizeof(long));
+    return;
+  }
+
+  size_t step = (size_t)stride;
+  const long *p = src;
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    long a = p[0];
+    long b = p[step];
+    long c = p[2 * step];
+    long d = p[3 * step];
+    dst[i] = a;
+    dst[i + 1] = b;
+    dst[i + 2] = c;
+    dst[i + 3] = d;
+    p += 4 * step;
+  }
+  for (; i < count; i++) {
+    dst[i] = *p;
+    p += step;
+  }
+}
+
+#endif /* PACK_H */
@@ -0,0 +1,53 @@
+/**
+  @file pairs.h
+  @brief PE pairing policies of the multi-pair point-to-point mode
+*/
+
+#ifndef PAIRS_H
+#define PAIRS_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+  @enum pair_policy_t
+  @brief How PEs are split into pairs (see --pairs)
+ */
+typedef enum {
+  PAIRS_NONE,        /* Single pair of a 2-PE job */
+  PAIRS_BLOCK,       /* PE i with PE i + npes/2 */
+  PAIRS_INTERLEAVED, /* PE 2k with PE 2k+1 */
+  PAIRS_INTRA,       /* Consecutive PEs of the same node */
+  PAIRS_INTER        /* PEs of different nodes */
+} pair_policy_t;
+
+/**
+  @brief Parse the name of a pairing policy
+  @param name "block", "interleaved", "intra" or "inter"
+  @param policy Parsed policy
+  @return True if the name is known, false otherwise
+ */
+bool pair_policy_parse(const char *name, pair_policy_t *policy);
+
+/**
+  @brief Get the name of a pairing policy
+  @param policy Pairing policy
+  @return Name as accepted by --pairs, or "none"
+ */
+const char *pair_policy_name(pair_policy_t policy);
+
+/**
+  @brief Split all PEs into pairs. Collective: every PE must call it and
+  every PE gets the same result. The lower PE of each pair is its
+  initiator; PEs that cannot be paired are left idle.
+  @param policy Pairing policy
+  @param partner Array of shmem_n_pes() entries receiving the partner of
+  every PE, or -1 for idle PEs
+  @return Number of pairs formed
+ */
+int pairs_build(pair_policy_t policy, int *partner);
+
+#endif /* PAIRS_H */
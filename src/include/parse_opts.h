@@ -6,13 +6,49 @@
 #ifndef PARSE_OPTS_H
 #define PARSE_OPTS_H
 
+#include <fnmatch.h>
 #include <getopt.h>
+#include <limits.h>
 #include <shmem.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "ordering.h"
+#include "pairs.h"
+#include "timer.h"
+#include "traffic.h"
+
+/* Most message-rate windows --window accepts */
+#define MAX_WINDOWS 16
+
+/* Operations in flight per completion of the message-rate benchmarks */
+#define DEFAULT_WINDOW 64
+
+/* Most chunkings --chunks accepts */
+#define MAX_CHUNKS 16
+
+/* Most strides --stride accepts */
+#define MAX_STRIDES 16
+
+/* Stride of the strided benchmarks in elements */
+#define DEFAULT_STRIDE 10
+
+/* Largest --src-offset and --dst-offset in bytes; offset buffers get this
+   much room past the largest message size */
+#define MAX_OFFSET 4095
+
+/**
+  @enum output_format_t
+  @brief Format results are written in (see --output)
+ */
+typedef enum {
+  OUTPUT_TEXT, /* Human-readable tables (default) */
+  OUTPUT_JSON, /* One JSON object per result row (JSON Lines) */
+  OUTPUT_CSV   /* Header line, then one line per result row */
+} output_format_t;
+
 /**
   @struct options
   @brief Struct to hold runtime options
@@ -21,12 +57,51 @@ typedef struct {
   /* Benchmark options */
   char *bench;
   char *benchtype;
+  char *types;
 
   /* Benchmark parameter options */
-  int min_msg_size;
-  int max_msg_size;
+  size_t min_msg_size;
+  size_t max_msg_size;
   int ntimes;
   int stride;
+  int strides[MAX_STRIDES];
+  int num_strides;
+  int windows[MAX_WINDOWS];
+  int num_windows;
+  int chunks[MAX_CHUNKS];
+  int num_chunks;
+  ordering_t orderings[MAX_ORDERINGS];
+  int num_orderings; /* 0: every benchmark completes its own way */
+  traffic_t traffic[MAX_TRAFFIC];
+  int num_traffic;
+  int traffic_reads;  /* Read:write ratio of the traffic benchmarks */
+  int traffic_writes;
+  double zipf;        /* Exponent of the zipf distribution */
+  int src_offset;
+  int dst_offset;
+  pair_policy_t pairs;
+
+  /* Message-size schedule options */
+  char *sizes;
+  double size_factor;
+  size_t size_step;
+
+  /* Measurement options */
+  bool percentiles;
+  int warmup;
+  bool warmup_auto;
+  timer_backend_t timer;
+  bool subtract_overhead;
+  bool pe_table;
+  double target_ci;
+  double max_time;
+  bool realloc_per_size;
+  bool cache_cold;
+  long cache_ring;
+
+  /* Output options */
+  output_format_t output;
+  char *output_file;
 
   /* Option to print help */
   bool help;
@@ -46,7 +121,7 @@ typedef struct {
   @return True if parsing is successful, false otherwise.
  */
 bool parse_opts(int argc, char *argv[], options *opts, char **benchmark,
-                char **benchtype, int *min_msg_size, int *max_msg_size,
+                char **benchtype, size_t *min_msg_size, size_t *max_msg_size,
                 int *ntimes, int *stride);
 
 /**
@@ -0,0 +1,187 @@
+/**
+  @file report.h
+  @brief Single result emitter behind the text, JSON Lines and CSV output
+*/
+
+#ifndef REPORT_H
+#define REPORT_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parse_opts.h"
+#include "sizes.h"
+#include "stats.h"
+#include "timer.h"
+
+/* A PE is flagged as a straggler when it is this much slower than the
+   median PE of the same row */
+#define STRAGGLER_THRESHOLD 1.25
+
+/**
+  @struct pe_summary_t
+  @brief Time per operation of one result row across all active PEs (us)
+ */
+typedef struct {
+  double min;
+  double avg;
+  double max;
+  int slowest_pe; /* PE that reported max */
+  int active;     /* Number of PEs that issued operations */
+} pe_summary_t;
+
+/* msg_size of the row of a size-less benchmark (atomics, barrier) */
+#define REPORT_NO_SIZE ((size_t)-1)
+
+/**
+  @struct report_row_t
+  @brief Everything reported for one message size (or one size-less run)
+ */
+typedef struct {
+  size_t msg_size;             /* Bytes, or REPORT_NO_SIZE for size-less
+                                  benchmarks */
+  int window;                  /* Operations per completion, or 0 */
+  int chunks;                  /* Pieces of each chunked transfer, or 0 */
+  const char *ordering;        /* --ordering semantic, or NULL */
+  const char *traffic;         /* --traffic distribution, or NULL */
+  double read_pct;             /* Reads of the --rw-ratio mix (%), or -1.0 */
+  int stride;                  /* Stride of strided rows in elements, or 0 */
+  size_t elems;                /* Elements per operation of strided rows */
+  int src_offset;              /* Bytes the source is shifted by */
+  int dst_offset;              /* Bytes the destination is shifted by */
+  long iters;                  /* Operations timed */
+  double time_us;              /* Average time per operation */
+  double bandwidth;            /* MB/s, or -1.0 if not applicable */
+  double msg_rate;             /* Operations per second */
+  double ci;                   /* Relative 95% CI half-width (%), or -1.0 */
+  double pure_us;              /* Overlap: time of the transfer alone */
+  double compute_us;           /* Overlap: time of the compute alone */
+  double overlap;              /* Transfer hidden behind compute (%), or -1.0 */
+  double compare_us;           /* Side by side: time of the alternative */
+  double compare_bw;           /* Side by side: MB/s of the alternative */
+  double penalty;              /* Bandwidth lost against offset 0 (%), or
+                                  -1.0 */
+  pe_summary_t pe;             /* Cross-PE summary of the time per op */
+  const sample_stats_t *stats; /* Latency distribution, or NULL */
+  const double *pe_times;      /* Every PE's time (-1 if idle), or NULL */
+  int pairs;                   /* Pairs of --pairs, or 0 */
+  const int *pair_pes;         /* Initiator and partner of every pair */
+  const double *pair_bw;       /* Bandwidth of every pair in MB/s */
+} report_row_t;
+
+/**
+  @struct report_info_t
+  @brief Identifies the benchmark a set of rows belongs to
+ */
+typedef struct {
+  const char *benchmark; /* e.g. "shmem_put" */
+  const char *benchtype; /* "bw", "bibw", "mr", "latency", "overlap",
+                            "pack", "align", "rma", "chase" or
+                            "updates" */
+  const char *op_name;   /* Noun for size-less text output (e.g. "Barrier"),
+                            or NULL for a table of message sizes */
+  const char *compare;   /* Benchmark reported side by side, or NULL */
+  const char *type;      /* Element type of a typed variant (see --type),
+                            or NULL */
+} report_info_t;
+
+/**
+  @struct report_type_row_t
+  @brief Summary of one typed variant for the type comparison table
+ */
+typedef struct {
+  const char *benchmark; /* Typed routine, e.g. "shmem_int_put" */
+  const char *type;      /* Name --type selects it by, e.g. "int" */
+  int elem_size;         /* Bytes per element */
+  int stride;            /* Stride of strided variants in elements, or 0 */
+  size_t min_size;       /* Smallest message size, rounded to elements */
+  double min_us;         /* Time per operation at the smallest size */
+  size_t peak_size;      /* Message size of the highest bandwidth */
+  double peak_bw;        /* Highest bandwidth of the sweep in MB/s */
+} report_type_row_t;
+
+/**
+  @brief Set up the emitter; only PE 0 writes results
+  @param opts Parsed runtime options (output format, file, configuration)
+  @param lib_name Name of the OpenSHMEM library
+  @param lib_version Version of the OpenSHMEM library
+  @param npes Number of PEs
+  @param ntimes Operations timed per batch
+  @param stride Stride of the strided benchmarks
+  @param sizes Message-size schedule of the run
+  @return True on success, false if the output file could not be opened
+ */
+bool report_open(const options *opts, const char *lib_name,
+                 const char *lib_version, int npes, int ntimes, int stride,
+                 const size_schedule_t *sizes);
+
+/**
+  @brief Flush and close the output file, if any
+ */
+void report_close(void);
+
+/**
+  @brief Get the stream results are written to
+  @return The --output-file stream, or stdout
+ */
+FILE *report_stream(void);
+
+/**
+  @brief Check whether human-readable decorations (logo, header, section
+  banners) belong in the output
+  @return True for text output, false for JSON Lines and CSV
+ */
+bool report_is_text(void);
+
+/**
+  @brief Emit the results of one benchmark in the selected format
+  @param info Benchmark the rows belong to
+  @param rows Result rows in message-size order
+  @param num_rows Number of rows
+ */
+void report_emit(const report_info_t *info, const report_row_t *rows,
+                 int num_rows);
+
+/**
+  @brief Emit the comparison of the typed variants of one benchmark (text
+  output only; the JSON and CSV rows of every variant carry its type)
+  @param info Benchmark the variants belong to
+  @param rows Summary of every variant in run order
+  @param num_rows Number of variants
+ */
+void report_emit_types(const report_info_t *info,
+                       const report_type_row_t *rows, int num_rows);
+
+/**
+  @brief Emit the bandwidth penalty of every offset of an alignment sweep
+  at every message size (text output only; the JSON and CSV rows of every
+  sweep carry their penalty)
+  @param info Benchmark the sweeps belong to
+  @param msg_sizes Message size of each row
+  @param num_sizes Number of rows
+  @param offsets Offset of each sweep in bytes
+  @param num_offsets Number of sweeps
+  @param penalty Penalty in percent, num_sizes per offset
+ */
+void report_emit_align(const report_info_t *info, const size_t *msg_sizes,
+                       int num_sizes, const int *offsets, int num_offsets,
+                       const double *penalty);
+
+/**
+  @brief Emit the time per operation of every --ordering semantic at every
+  message size, with what each costs against the first (text output only;
+  the JSON and CSV rows of every sweep carry their semantic)
+  @param info Benchmark the sweeps belong to
+  @param msg_sizes Message size of each row
+  @param num_sizes Number of rows
+  @param orderings Name of each sweep's semantic
+  @param num_orderings Number of sweeps
+  @param time_us Time per operation in microseconds, num_sizes per sweep
+ */
+void report_emit_ordering(const report_info_t *info, const size_t *msg_sizes,
+                          int num_sizes, const char *const *orderings,
+                          int num_orderings, const double *time_us);
+
+#endif /* REPORT_H */
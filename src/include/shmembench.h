@@ -6,6 +6,7 @@
 #ifndef SHMEMBENCH_H
 #define SHMEMBENCH_H
 
+#include <fnmatch.h>
 #include <getopt.h>
 #include <shmem.h>
 #include <stdbool.h>
@@ -13,8 +14,16 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
 
-#include "benchmarks.h"
+#include "bufpool.h"
+#include "cache.h"
+#include "parse_opts.h"
+#include "report.h"
+#include "sizes.h"
+#include "stats.h"
+#include "timer.h"
 
 /* ANSI color codes for pretty output */
 #define RESET_COLOR "\033[0m"
@@ -24,15 +33,34 @@
 
 #define HLINE "--------------------------------------------"
 
+/* Steady-state warmup: operations per window, relative tolerance between
+   consecutive window means, and the budget after which warmup gives up */
+#define WARMUP_WINDOW 16
+#define WARMUP_TOLERANCE 0.05
+#define WARMUP_MAX_WINDOWS 64
+#define WARMUP_MAX_SECONDS 2.0
+
+/* Adaptive iteration count: batches always timed before the CI target can
+   stop a row, hard cap on batches per row, defaults for whichever of
+   --target-ci (percent) and --max-time (seconds per row) is not given, and
+   the most per-operation samples kept for --percentiles */
+#define MEASURE_MIN_BATCHES 3
+#define MEASURE_MAX_BATCHES 1000
+#define MEASURE_DEFAULT_TARGET_CI 1.0
+#define MEASURE_DEFAULT_MAX_TIME 1.0
+#define MEASURE_MAX_SAMPLES (1 << 22)
+
 /**
-  @brief Validate and adjust message size for typed operations.
-  Ensures the size is a multiple of the specified type size.
+  @brief Round a message size to whole elements of a typed operation.
+  Sizes below one element become one element, the others are rounded down
+  to a multiple of the element size.
   @param size The requested message size in bytes
   @param type_size Size of the datatype (e.g., sizeof(long))
   @param type_name String name of the type (for warning messages)
-  @return The adjusted message size that's valid for the type
+  @return The message size rounded to whole elements
  */
-int validate_typed_size(int size, size_t type_size, const char *type_name);
+size_t validate_typed_size(size_t size, size_t type_size,
+                           const char *type_name);
 
 /**
   @brief Calculate the number of elements needed based on byte size
@@ -40,21 +68,21 @@ int validate_typed_size(int size, size_t type_size, const char *type_name);
   @param type_size Size of each element in bytes
   @return Number of elements
  */
-int calculate_elem_count(int byte_size, size_t type_size);
+size_t calculate_elem_count(size_t byte_size, size_t type_size);
 
 /**
-  @brief Run the selected benchmark
-  @param benchmark The benchmark to be run (e.g., "shmem_put", "shmem_get")
+  @brief Run every selected benchmark, each in its own section
+  @param benchmark Comma-separated benchmarks to run (e.g., "shmem_put"),
+  glob patterns (e.g., "shmem_atomic_*") or "all"
   @param benchtype The type of benchmark to run, either "bw", "bibw", or
-  "latency"
-  @param min_msg_size Minimum message size for test in bytes
+  "latency", or NULL for each benchmark's default
   @param max_msg_size Maximum message size for test in bytes
   @param ntimes Number of times the benchmark should run
-  @param stride Stride value to use for the benchmark (only applicable to
-  certain benchmarks)
+  @param opts Parsed runtime options (measurement modes; the strided
+  benchmarks sweep every stride of opts)
  */
-void run_benchmark(char *benchmark, char *benchtype, int min_msg_size,
-                   int max_msg_size, int ntimes, int stride);
+void run_benchmark(char *benchmark, char *benchtype, size_t max_msg_size,
+                   int ntimes, const options *opts);
 
 /**
   @brief Calculate bandwidth based on message size and time
@@ -62,7 +90,7 @@ void run_benchmark(char *benchmark, char *benchtype, int min_msg_size,
   @param time Time taken for the operation in microseconds
   @return The calculated bandwidth in MB/s
  */
-double calculate_bw(int size, double time);
+double calculate_bw(size_t size, double time);
 
 // /**
 //   @brief Calculate collective bandwidth based on message size,
@@ -80,7 +108,7 @@ double calculate_bw(int size, double time);
   @param time Time taken for the operation in microseconds
   @return The calculated bidirectional bandwidth in MB/s
  */
-double calculate_bibw(int size, double time);
+double calculate_bibw(size_t size, double time);
 
 /**
   @brief Calculate latency based on time
@@ -94,26 +122,258 @@ double calculate_latency(double time);
   @param times Time array for benchmark timings
   @param msg_size Message size array
   @param results BW/Latency array
-  @param benchtype Type of benchmark ("bw", "bibw", or "latency")
+  @param benchtype Type of benchmark ("bw", "bibw", "mr", "latency",
+  "overlap", "pack", "align", "rma", "chase" or "updates")
   @param num_sizes Number of rows in the table
+  @param window Operations per completion of message-rate rows, or 0
+  @param chunks Pieces each transfer of chunked rows is split into, or 0
+  @param stride Stride of strided rows in elements, or 0
+  @param src_offset Bytes the source was shifted into its buffer
+  @param dst_offset Bytes the destination was shifted into its buffer
+  @param ordering Name of the --ordering semantic of the rows, or NULL
+  @param traffic Name of the --traffic distribution of the rows, or NULL
+ */
+void display_results(double *times, size_t *msg_size, double *results,
+                     const char *benchtype, int num_sizes, int window,
+                     int chunks, int stride, int src_offset, int dst_offset,
+                     const char *ordering, const char *traffic);
+
+/**
+  @brief Display the bandwidth penalty of every offset of the alignment
+  sweep at every message size, after the last sweep of an align op
+  @param msg_sizes Message size of each row
+  @param num_sizes Number of rows
+ */
+void display_align_results(const size_t *msg_sizes, int num_sizes);
+
+/**
+  @brief Display the time per operation of every --ordering semantic at
+  every message size, after the last sweep of an op run once per semantic
+  @param msg_sizes Message size of each row
+  @param num_sizes Number of rows
+  @param orderings Semantic of each sweep
+  @param num_orderings Number of semantics
+ */
+void display_ordering_results(const size_t *msg_sizes, int num_sizes,
+                              const ordering_t *orderings,
+                              int num_orderings);
+
+/**
+  @brief Display the results of a size-less latency benchmark (atomics,
+  barrier) from row 0 of the measurement and cross-PE aggregation
+  @param op_name Noun for one operation in text output (e.g. "Barrier")
+  @param traffic Name of the --traffic distribution of the row, or NULL
+ */
+void display_latency_results(const char *op_name, const char *traffic);
+
+/* Message sizes every sweep iterates (see --sizes, --size-factor and
+   --size-step) */
+extern size_schedule_t bench_sizes;
+
+/* Windows the message-rate benchmarks sweep (see --window) */
+extern int bench_windows[MAX_WINDOWS];
+extern int bench_num_windows;
+
+/* Chunkings the chunked transfer benchmarks sweep (see --chunks) */
+extern int bench_chunks[MAX_CHUNKS];
+extern int bench_num_chunks;
+
+/* Ordering semantics the point-to-point RMA benchmarks sweep (see
+   --ordering); none means every benchmark completes its own way */
+extern ordering_t bench_orderings[MAX_ORDERINGS];
+extern int bench_num_orderings;
+
+/* Distributions the traffic benchmarks sweep (see --traffic), and their
+   read:write ratio and Zipf exponent (see --rw-ratio and --zipf) */
+extern traffic_t bench_traffic[MAX_TRAFFIC];
+extern int bench_num_traffic;
+extern int bench_traffic_reads;
+extern int bench_traffic_writes;
+extern double bench_zipf;
+
+/* Strides the strided benchmarks sweep (see --stride) */
+extern int bench_strides[MAX_STRIDES];
+extern int bench_num_strides;
+
+/* Offsets of the contiguous byte benchmarks (see --src-offset and
+   --dst-offset) */
+extern int bench_src_offset;
+extern int bench_dst_offset;
+
+/* Bytes the buffer copies of cold runs rotate through (see --cache), or
+   0 for warm runs */
+extern size_t bench_cache_ring;
+
+/* Per-operation samples of the running benchmark (see --percentiles) */
+extern bool bench_sampling;
+extern sample_buffer_t bench_samples;
+
+/**
+  @brief Start sampling a batch of operations.
+  Samples accumulate over all batches of a row until bench_measure_begin().
+  @param start_time Timestamp (seconds) taken right before the first operation
+ */
+static inline void bench_sample_begin(double start_time) {
+  if (bench_sampling) {
+    bench_samples.last = start_time;
+  }
+}
+
+/**
+  @brief Record the time since the previous mark as one operation's duration
+ */
+static inline void bench_sample_mark(void) {
+  if (bench_sampling) {
+    sample_buffer_mark(&bench_samples, mysecond());
+  }
+}
+
+/**
+  @brief Reduce the recorded samples to a distribution for one result row
+  @param row Index of the message size (row) the samples belong to
+  @param transfers One-way transfers each sample spans (e.g. 2 for a
+  ping-pong round trip); the distribution is reported per transfer
+ */
+void bench_sample_commit(int row, int transfers);
+
+/**
+  @brief Start the untimed warmup phase of a benchmark
+  @param collective True if every PE takes part in each operation, so all
+  PEs have to agree on when the steady state is reached
+ */
+void bench_warmup_begin(bool collective);
+
+/**
+  @brief Get the number of untimed operations to run in the next window
+  @return Operations in the next window, or 0 when warmup is over
+ */
+int bench_warmup_next(void);
+
+/**
+  @brief Feed back the duration of the window that just ran
+  @param elapsed Time taken by the window in seconds
+ */
+void bench_warmup_end_window(double elapsed);
+
+/**
+  @brief Start timing the batches of one result row
+ */
+void bench_measure_begin(void);
+
+/**
+  @brief Feed back one timed batch and decide whether to time another.
+  Without --target-ci/--max-time a single batch is timed. Otherwise batches
+  are timed until the 95% CI of the mean is within the target (after at
+  least MEASURE_MIN_BATCHES), the time budget is spent or MEASURE_MAX_BATCHES
+  is reached. Must be called by all PEs; everyone follows PE 0.
+  @param elapsed Time taken by the batch in seconds
+  @param ops Number of operations in the batch
+  @return True if another batch should be timed
+ */
+bool bench_measure_batch(double elapsed, int ops);
+
+/**
+  @brief Finish the measurement of one result row
+  @param row Index of the message size (row) being measured
+  @return Average time per operation over all batches in microseconds
+ */
+double bench_measure_end(int row);
+
+/**
+  @brief Get the number of operations timed for one result row
+  @param row Index of the row
+  @return Operations timed over all batches of the row
+ */
+long bench_measure_iters(int row);
+
+/**
+  @brief Gather every PE's time for one result row and summarize it.
+  Must be called by all PEs, once per row.
+  @param row Index of the message size (row) the time belongs to
+  @param time Time per operation measured on this PE in microseconds
+  @param active True if this PE issued the timed operations; idle PEs
+  (e.g. the target of a one-sided put) are left out of the summary
+ */
+void bench_aggregate_times(int row, double time, bool active);
+
+/**
+  @brief Get the cross-PE summary of one result row
+  @param row Index of the row
+  @return Summary of the row, or NULL if the row does not exist
+ */
+const pe_summary_t *bench_pe_row(int row);
+
+/**
+  @brief Check whether the point-to-point benchmarks run on many pairs
+  @return True if --pairs was given
  */
-void display_results(double *times, int *msg_size, double *results,
-                     const char *benchtype, int num_sizes);
+bool bench_multipair(void);
 
 /**
-  @brief Display results for atomic latency benchmarks
-  @param benchmark The name of the benchmark (e.g., "shmem_atomic_add")
-  @param total_time The total time taken for the operations in microseconds
-  @param ntimes The number of times the operation was performed
+  @brief Get the number of pairs formed by --pairs
+  @return Number of pairs, or 0 without --pairs
  */
-void display_atomic_latency_results(const char *benchmark, double total_time,
-                                    int ntimes);
+int bench_pair_count(void);
 
 /**
-  @brief Get current time
-  @return Current time in seconds
+  @brief Get the partner of this PE under --pairs
+  @return Partner PE, or -1 if this PE was left out of the pairs
  */
-double mysecond(void);
+int bench_pair_peer(void);
+
+/**
+  @brief Compute the bandwidth of every pair for one result row from the
+  gathered per-PE times. Call after bench_aggregate_times for the row.
+  @param row Index of the row
+  @param bytes Bytes one operation moves
+  @return Aggregate bandwidth over all pairs in MB/s
+ */
+double bench_pair_commit(int row, size_t bytes);
+
+/**
+  @brief Record the timings of one overlap row and compute the share of the
+  transfer hidden behind compute
+  @param row Index of the row
+  @param pure Time per operation of the transfer alone in microseconds
+  @param compute Time per operation of the compute loop alone
+  @param overall Time per operation of issue, compute and completion
+  @return Overlap in percent, from 0 (none) to 100 (fully hidden)
+ */
+double bench_overlap_commit(int row, double pure, double compute,
+                            double overall);
+
+/**
+  @brief Record the alternative an op is compared against on one row
+  @param row Index of the row
+  @param time Time per operation of the alternative in microseconds
+  @param bw Bandwidth of the alternative in MB/s
+ */
+void bench_compare_commit(int row, double time, double bw);
+
+/**
+  @brief Record the bandwidth of one row of an alignment sweep
+  @param pass Index of the sweep's offset in bench_align_offsets
+  @param row Index of the row
+  @param bw Bandwidth of the row in MB/s
+ */
+void bench_align_commit(int pass, int row, double bw);
+
+/**
+  @brief Record the time per operation of one row under one --ordering
+  semantic
+  @param pass Index of the semantic in bench_orderings
+  @param row Index of the row
+  @param time Time per operation in microseconds
+ */
+void bench_ordering_commit(int pass, int row, double time);
+
+/**
+  @brief Check that every PE can reach its peer's symmetric memory with
+  plain loads and stores through shmem_ptr. Must be called by all PEs.
+  @param peer Peer of this PE, or -1 if it has none
+  @return True on every PE if all of them can
+ */
+bool bench_ptr_reachable(int peer);
 
 /**
   @brief Check if there are exactly 2 PEs
@@ -128,10 +388,8 @@ bool check_if_exactly_2_pes(void);
 bool check_if_atleast_2_pes(void);
 
 /**
-  @brief Setup the benchmark by calculating the number of message sizes and
-  allocating arrays
-  @param min_msg_size Minimum message size for the benchmark in bytes
-  @param max_msg_size Maximum message size for the benchmark in bytes
+  @brief Setup the benchmark by taking the message sizes from the shared
+  schedule (bench_sizes) and allocating arrays
   @param num_sizes Pointer to store the number of message sizes
   @param msg_sizes Pointer to an array to store the message sizes
   @param times Pointer to an array to store the timing results
@@ -139,8 +397,8 @@ bool check_if_atleast_2_pes(void);
   latency)
   @return True if setup was successful, false otherwise
  */
-bool setup_bench(int min_msg_size, int max_msg_size, int *num_sizes,
-                 int **msg_sizes, double **times, double **results);
+bool setup_bench(int *num_sizes, size_t **msg_sizes, double **times,
+                 double **results);
 
 /**
   @brief Displays the ASCII art logo.
@@ -156,17 +414,20 @@ void display_logo(void);
   @param shmem_name Name of the OpenSHMEM library.
   @param shmem_version Version of the OpenSHMEM library.
   @param npes Number of PEs (Processing Elements).
-  @param benchmark Selected benchmark.
+  @param benchmark Selected benchmarks (comma list, globs or "all").
   @param benchtype The type of benchmark to run, either "bw", "bibw", or
-  "latency"
+  "latency", or NULL for each benchmark's default
   @param min_msg_size Minimum message size for test in bytes.
   @param max_msg_size Maximum message size for test in bytes.
   @param ntimes Number of times the benchmark should run.
-  @param stride Stride value to use for the benchmark (only applicable to
-  certain benchmarks).
+  @param opts Parsed runtime options (measurement modes).
  */
 void display_header(char *shmem_name, char *shmem_version, int npes,
-                    char *benchmark, char *benchtype, int min_msg_size,
-                    int max_msg_size, int ntimes, int stride);
+                    char *benchmark, char *benchtype, size_t min_msg_size,
+                    size_t max_msg_size, int ntimes, const options *opts);
+
+/* Op descriptors and the engine that runs them */
+#include "engine.h"
+#include "benchmarks.h"
 
 #endif /* SHMEMBENCH_H */
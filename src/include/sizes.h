@@ -0,0 +1,90 @@
+/**
+  @file sizes.h
+  @brief Message-size schedule shared by every RMA and collective sweep
+*/
+
+#ifndef SIZES_H
+#define SIZES_H
+
+#include <errno.h>
+#include <shmem.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Growth factor of the default geometric schedule */
+#define SIZE_DEFAULT_FACTOR 2.0
+
+/* Most sizes a schedule may hold; each one is a row of every table */
+#define SIZE_MAX_ROWS 4096
+
+/**
+  @enum size_schedule_kind_t
+  @brief How the message sizes of a sweep were generated
+ */
+typedef enum {
+  SIZE_GEOMETRIC, /* min, min * factor, ... up to max */
+  SIZE_LINEAR,    /* min, min + step, ... up to max */
+  SIZE_LIST       /* Explicit --sizes list */
+} size_schedule_kind_t;
+
+/**
+  @struct size_schedule_t
+  @brief Ascending list of message sizes (bytes) every sweep iterates
+ */
+typedef struct {
+  size_t *sizes;             /* Message sizes in bytes, ascending */
+  int count;                 /* Number of sizes */
+  size_t min;                /* Smallest size */
+  size_t max;                /* Largest size */
+  size_schedule_kind_t kind; /* How the sizes were generated */
+  double factor;             /* Growth factor of a geometric schedule */
+  size_t step;               /* Increment of a linear schedule */
+} size_schedule_t;
+
+/**
+  @brief Parse a size in bytes with an optional binary suffix: K, M, G or
+  T (e.g. "64K", "16G")
+  @param text Size to parse
+  @param size Set to the size in bytes
+  @param end Set to the first character after the size, or NULL to
+  require the whole of text to be the size
+  @return True if a size greater than zero was parsed without overflow
+ */
+bool size_parse(const char *text, size_t *size, const char **end);
+
+/**
+  @brief Generate a message-size schedule.
+  An explicit list wins over min/max; otherwise a positive step gives a
+  linear schedule and anything else a geometric one.
+  @param sched Schedule to fill in
+  @param list Comma-separated sizes (e.g. "8,24,4000,1G"), or NULL
+  @param min Smallest size for generated schedules
+  @param max Largest size for generated schedules
+  @param factor Growth factor (> 1) of a geometric schedule, or 0 for the
+  default of SIZE_DEFAULT_FACTOR
+  @param step Increment of a linear schedule, or 0 for a geometric one
+  @return True on success, false if the parameters are invalid
+ */
+bool size_schedule_build(size_schedule_t *sched, const char *list,
+                         size_t min, size_t max, double factor, size_t step);
+
+/**
+  @brief Release the sizes owned by a schedule
+  @param sched Schedule to free
+ */
+void size_schedule_free(size_schedule_t *sched);
+
+/**
+  @brief Describe how a schedule was generated (e.g. "x2.00, 8 sizes")
+  @param sched Schedule to describe
+  @param buf Output buffer
+  @param len Size of the output buffer
+ */
+void size_schedule_describe(const size_schedule_t *sched, char *buf,
+                            size_t len);
+
+#endif /* SIZES_H */
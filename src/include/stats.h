@@ -0,0 +1,115 @@
+/**
+  @file stats.h
+  @brief Per-iteration sample storage and latency distribution statistics
+*/
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+  @struct sample_buffer_t
+  @brief Preallocated per-PE storage for per-operation durations.
+  The buffer is sized once before a benchmark runs so recording a sample
+  inside a timed loop never allocates.
+ */
+typedef struct {
+  double *samples; /* Per-operation durations in seconds */
+  double last;     /* Timestamp of the previous mark in seconds */
+  int capacity;    /* Number of slots in samples */
+  int count;       /* Number of samples recorded so far */
+} sample_buffer_t;
+
+/**
+  @struct sample_stats_t
+  @brief Distribution summary of one set of samples (all values in us)
+ */
+typedef struct {
+  double min;
+  double p50;
+  double p90;
+  double p99;
+  double p999;
+  double max;
+  double mean;
+  double stddev;
+  int count;
+} sample_stats_t;
+
+/**
+  @brief Allocate storage for up to capacity samples
+  @param buf Sample buffer to initialize
+  @param capacity Maximum number of samples that will be recorded
+  @return True if the allocation succeeded, false otherwise
+ */
+bool sample_buffer_init(sample_buffer_t *buf, int capacity);
+
+/**
+  @brief Release the storage owned by a sample buffer
+  @param buf Sample buffer to free
+ */
+void sample_buffer_free(sample_buffer_t *buf);
+
+/**
+  @brief Discard recorded samples and set the reference timestamp
+  @param buf Sample buffer to reset
+  @param start_time Timestamp (seconds) the first mark is measured from
+ */
+static inline void sample_buffer_reset(sample_buffer_t *buf,
+                                       double start_time) {
+  buf->count = 0;
+  buf->last = start_time;
+}
+
+/**
+  @brief Record one duration in seconds, dropping it if the buffer is full
+  @param buf Sample buffer
+  @param duration Duration of the operation in seconds
+ */
+static inline void sample_buffer_record(sample_buffer_t *buf,
+                                        double duration) {
+  if (buf->count < buf->capacity) {
+    buf->samples[buf->count++] = duration;
+  }
+}
+
+/**
+  @brief Record the time elapsed since the previous mark
+  @param buf Sample buffer
+  @param now Current timestamp in seconds
+ */
+static inline void sample_buffer_mark(sample_buffer_t *buf, double now) {
+  sample_buffer_record(buf, now - buf->last);
+  buf->last = now;
+}
+
+/**
+  @brief Compute min/percentiles/max, mean and standard deviation.
+  Sorts the recorded samples in place, so call it outside the timed region.
+  @param buf Sample buffer holding durations in seconds
+  @param stats Output statistics in microseconds
+ */
+void compute_sample_stats(sample_buffer_t *buf, sample_stats_t *stats);
+
+/**
+  @brief Return the nearest-rank percentile of a sorted array
+  @param sorted Samples sorted in ascending order
+  @param count Number of samples
+  @param pct Percentile in the range [0, 100]
+  @return The requested percentile, or 0.0 if count is 0
+ */
+double percentile_sorted(const double *sorted, int count, double pct);
+
+/**
+  @brief Two-sided 95% critical value of Student's t distribution
+  @param df Degrees of freedom (at least 1)
+  @return The 0.975 quantile of t with df degrees of freedom
+ */
+double student_t_975(int df);
+
+#endif /* STATS_H */
@@ -0,0 +1,139 @@
+/**
+  @file timer.h
+  @brief Low-overhead timer layer with a calibrated cycle-counter backend
+*/
+
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define TIMER_HAVE_CYCLE_COUNTER 1
+#elif defined(__aarch64__)
+#define TIMER_HAVE_CYCLE_COUNTER 1
+#else
+#define TIMER_HAVE_CYCLE_COUNTER 0
+#endif
+
+/* How long the cycle counter is calibrated against CLOCK_MONOTONIC */
+#define TIMER_CALIBRATION_SECONDS 0.05
+
+/* Back-to-back reads used to estimate timer overhead and resolution */
+#define TIMER_PROBE_READS 10000
+
+/**
+  @enum timer_backend_t
+  @brief Source of timestamps behind mysecond()
+ */
+typedef enum {
+  TIMER_AUTO,         /* Cycle counter if it is usable, else clock_gettime */
+  TIMER_CYCLES,       /* rdtscp on x86, cntvct_el0 on aarch64 */
+  TIMER_CLOCK_GETTIME /* clock_gettime(CLOCK_MONOTONIC) */
+} timer_backend_t;
+
+/**
+  @struct timer_info_t
+  @brief Selected backend and its calibration results
+ */
+typedef struct {
+  timer_backend_t backend; /* Backend actually in use */
+  double sec_per_tick;     /* Seconds per tick of the backend */
+  uint64_t epoch;          /* Tick value mysecond() is relative to */
+  double overhead_ns;      /* Median cost of one timer read */
+  double resolution_ns;    /* Smallest observable nonzero step */
+  bool subtract_overhead;  /* Remove overhead from per-operation results */
+} timer_info_t;
+
+/* Calibrated timer state, filled in by timer_init() */
+extern timer_info_t timer_info;
+
+/**
+  @brief Read the raw tick counter of the cycle-counter backend
+  @return Current tick count
+ */
+static inline uint64_t timer_read_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  /* rdtscp waits for earlier instructions, lfence keeps later ones out */
+  unsigned int aux;
+  uint64_t ticks = __rdtscp(&aux);
+  _mm_lfence();
+  return ticks;
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  __asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r"(ticks)::"memory");
+  return ticks;
+#else
+  return 0;
+#endif
+}
+
+/**
+  @brief Read CLOCK_MONOTONIC in nanoseconds
+  @return Current monotonic time in nanoseconds
+ */
+static inline uint64_t timer_read_monotonic(void) {
+#if defined(_POSIX_TIMERS) && !defined(__APPLE__)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+  }
+#endif
+  /* Fallback to gettimeofday if clock_gettime isn't available or fails. */
+  struct timeval tp;
+  gettimeofday(&tp, NULL);
+  return (uint64_t)tp.tv_sec * 1000000000ull + (uint64_t)tp.tv_usec * 1000ull;
+}
+
+/**
+  @brief Read the selected backend
+  @return Current tick count of the selected backend
+ */
+static inline uint64_t timer_ticks(void) {
+  if (timer_info.backend == TIMER_CYCLES) {
+    return timer_read_cycles();
+  }
+  return timer_read_monotonic();
+}
+
+/**
+  @brief Get current time
+  @return Seconds elapsed since timer_init(). Timestamps are kept relative to
+  startup so the double keeps sub-nanosecond precision.
+ */
+static inline double mysecond(void) {
+  return (double)(timer_ticks() - timer_info.epoch) * timer_info.sec_per_tick;
+}
+
+/**
+  @brief Select and calibrate the timer backend.
+  The cycle counter is calibrated against CLOCK_MONOTONIC, then the overhead
+  and resolution of the selected backend are measured.
+  @param requested Backend requested on the command line
+  @param subtract_overhead Remove the measured read overhead from
+  per-operation results
+ */
+void timer_init(timer_backend_t requested, bool subtract_overhead);
+
+/**
+  @brief Get a printable name for a timer backend
+  @param backend Backend to name
+  @return Static string naming the backend
+ */
+const char *timer_backend_name(timer_backend_t backend);
+
+/**
+  @brief Timer read overhead to remove from a per-operation result
+  @return Overhead in microseconds, or 0.0 if subtraction is disabled
+ */
+double timer_overhead_us(void);
+
+#endif /* TIMER_H */
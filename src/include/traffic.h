@@ -0,0 +1,102 @@
+/**
+  @file traffic.h
+  @brief Target PE and remote offset distributions of the random-access
+  traffic benchmarks (see --traffic)
+*/
+
+#ifndef TRAFFIC_H
+#define TRAFFIC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Number of distributions, and the most --traffic accepts */
+#define MAX_TRAFFIC 4
+
+/* Default Zipf exponent of the hotspot distribution (see --zipf) */
+#define DEFAULT_ZIPF 0.99
+
+/**
+  @enum traffic_t
+  @brief Where the accesses of a traffic benchmark go
+ */
+typedef enum {
+  TRAFFIC_UNIFORM,    /* Any PE and any slot, equally likely */
+  TRAFFIC_ZIPF,       /* PE k and slot k with weight 1 / (k + 1)^s, so
+                         PE 0 and slot 0 are the hotspot of every PE */
+  TRAFFIC_NEIGHBOR,   /* The next and previous PE in turn, streaming
+                         through their slots */
+  TRAFFIC_PERMUTATION /* One fixed partner per PE (a random cycle through
+                         all PEs), its slots in one fixed random order */
+} traffic_t;
+
+/**
+  @struct traffic_access_t
+  @brief One precomputed access of a traffic benchmark
+ */
+typedef struct {
+  int pe;        /* Target PE */
+  bool write;    /* Write (put, p) rather than read (get, g) */
+  size_t offset; /* Bytes into the target's region */
+} traffic_access_t;
+
+/**
+  @brief Parse the name of a traffic distribution
+  @param name "uniform", "zipf", "neighbor" or "permutation"
+  @param traffic Parsed distribution
+  @return True if the name is known, false otherwise
+ */
+bool traffic_parse(const char *name, traffic_t *traffic);
+
+/**
+  @brief Parse a comma-separated list of traffic distributions
+  @param arg List to parse, e.g. "uniform,zipf"
+  @param traffic Parsed distributions
+  @param max Most distributions the list may hold
+  @param count Number of distributions parsed
+  @return True if every name is known and the list is not too long
+ */
+bool traffic_parse_list(const char *arg, traffic_t *traffic, int max,
+                        int *count);
+
+/**
+  @brief Parse a read:write ratio
+  @param arg Ratio to parse, e.g. "3:1" (reads first)
+  @param reads Parsed reads
+  @param writes Parsed writes
+  @return True if both are counts >= 0 and not both 0
+ */
+bool traffic_parse_ratio(const char *arg, int *reads, int *writes);
+
+/**
+  @brief Get the name of a traffic distribution
+  @param traffic Traffic distribution
+  @return Name as accepted by --traffic
+ */
+const char *traffic_name(traffic_t traffic);
+
+/**
+  @brief Precompute the accesses of one PE, so no random number is drawn
+  in the timed loop. Exactly count * writes / (reads + writes) of them
+  (rounded down) are writes, shuffled among the reads.
+  @param accesses Filled with count accesses
+  @param count Number of accesses
+  @param traffic Distribution of the target PEs and slots
+  @param zipf Exponent s of TRAFFIC_ZIPF
+  @param reads Reads of the read:write ratio
+  @param writes Writes of the read:write ratio
+  @param mype This PE
+  @param npes Number of PEs
+  @param slots Slots of the region on every PE
+  @param slot_bytes Bytes from one slot to the next
+  @return True on success, false if memory ran out
+ */
+bool traffic_generate(traffic_access_t *accesses, int count,
+                      traffic_t traffic, double zipf, int reads, int writes,
+                      int mype, int npes, size_t slots, size_t slot_bytes);
+
+#endif /* TRAFFIC_H */
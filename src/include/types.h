@@ -0,0 +1,96 @@
+/**
+  @file types.h
+  @brief X-macro lists of the element types the typed RMA routines of the
+  OpenSHMEM specification come in, used to generate one typed variant of a
+  benchmark per type (see --type)
+*/
+
+#ifndef TYPES_H
+#define TYPES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+  @brief Standard RMA types of the specification (TYPENAME and TYPE of
+  shmem_TYPENAME_put and friends)
+  @param X Callback invoked as X(TYPENAME, TYPE, arg)
+  @param arg Passed through to every X
+ */
+#define BENCH_RMA_TYPES(X, arg)                                                \
+  X(float, float, arg)                                                         \
+  X(double, double, arg)                                                       \
+  X(longdouble, long double, arg)                                              \
+  X(char, char, arg)                                                           \
+  X(schar, signed char, arg)                                                   \
+  X(short, short, arg)                                                         \
+  X(int, int, arg)                                                             \
+  X(long, long, arg)                                                           \
+  X(longlong, long long, arg)                                                  \
+  X(uchar, unsigned char, arg)                                                 \
+  X(ushort, unsigned short, arg)                                               \
+  X(uint, unsigned int, arg)                                                   \
+  X(ulong, unsigned long, arg)                                                 \
+  X(ulonglong, unsigned long long, arg)                                        \
+  X(int8, int8_t, arg)                                                         \
+  X(int16, int16_t, arg)                                                       \
+  X(int32, int32_t, arg)                                                       \
+  X(int64, int64_t, arg)                                                       \
+  X(uint8, uint8_t, arg)                                                       \
+  X(uint16, uint16_t, arg)                                                     \
+  X(uint32, uint32_t, arg)                                                     \
+  X(uint64, uint64_t, arg)                                                     \
+  X(size, size_t, arg)                                                         \
+  X(ptrdiff, ptrdiff_t, arg)
+
+/**
+  @brief Element sizes of the fixed-size routines (shmem_putSIZE and friends)
+  @param X Callback invoked as X(SIZE, BYTES, arg), SIZE in bits
+  @param arg Passed through to every X
+ */
+#define BENCH_SIZED_TYPES(X, arg)                                              \
+  X(8, 1, arg)                                                                 \
+  X(16, 2, arg)                                                                \
+  X(32, 4, arg)                                                                \
+  X(64, 8, arg)                                                                \
+  X(128, 16, arg)
+
+/* Entries of the variant arrays of a routine: its variant of one type for
+   one benchtype, named bench_<routine>_<TYPENAME or SIZE>_<benchtype> */
+#define BENCH_TYPED_ENTRY_BW(name, type, routine)                              \
+  &bench_##routine##_##name##_bw,
+#define BENCH_TYPED_ENTRY_BIBW(name, type, routine)                            \
+  &bench_##routine##_##name##_bibw,
+#define BENCH_TYPED_ENTRY_LATENCY(name, type, routine)                         \
+  &bench_##routine##_##name##_latency,
+#define BENCH_TYPED_ENTRY_MR(name, type, routine)                              \
+  &bench_##routine##_##name##_mr,
+
+/**
+  @brief Define the bw and bibw variants of one type of a point-to-point
+  RMA routine. They are only reachable through the typed array of the
+  routine's long op, so they are declared here rather than in a header.
+  @param var Prefix of the descriptors (var##_bw and var##_bibw)
+  @param routine Name of the typed routine, e.g. "shmem_int_put"
+  @param type_name Name --type selects the variant by, e.g. "int"
+  @param c_name Element type, for warnings, e.g. "int"
+  @param bytes Bytes per element
+  @param strided True for strided routines (take --stride)
+  @param prepare_fn Prepare hook, or NULL for plain buffers
+  @param issue_fn Issue hook
+ */
+#define BENCH_DEFINE_TYPED_OPS(var, routine, type_name, c_name, bytes,        \
+                               strided, prepare_fn, issue_fn)                  \
+  extern const bench_op_t var##_bw, var##_bibw;                                \
+  BENCH_DEFINE_OP(var##_bw, .benchmark = routine, .benchtype = "bw",           \
+                  .pes = BENCH_EXACTLY_2_PES, .issuers = BENCH_ISSUE_PE0,      \
+                  .sized = true, .uses_stride = strided, .elem_size = bytes,   \
+                  .elem_name = c_name, .type = type_name,                      \
+                  .prepare = prepare_fn, .issue = issue_fn);                   \
+  BENCH_DEFINE_OP(var##_bibw, .benchmark = routine, .benchtype = "bibw",       \
+                  .pes = BENCH_EXACTLY_2_PES, .issuers = BENCH_ISSUE_ALL,      \
+                  .sized = true, .uses_stride = strided, .elem_size = bytes,   \
+                  .elem_name = c_name, .type = type_name,                      \
+                  .prepare = prepare_fn, .issue = issue_fn)
+
+#endif /* TYPES_H */
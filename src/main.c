@@ -26,13 +26,6 @@ int main(int argc, char *argv[]) {
   int mype = shmem_my_pe();
   int npes = shmem_n_pes();
 
-  /**
-    Display logo
-  */
-  if (mype == 0) {
-    display_logo();
-  }
-
   /**
     Get the OpenSHMEM impl version
   */
@@ -60,14 +53,15 @@ int main(int argc, char *argv[]) {
     Parse options
   */
   options opts;
-  char *benchmark = (char *)malloc(100 * sizeof(char));
-  char *benchtype = (char *)malloc(100 * sizeof(char));
-  int min_msg_size, max_msg_size;
+  char *benchmark = NULL; /* Set by parse_opts from --bench */
+  char *benchtype = NULL; /* NULL runs each benchmark's default benchtype */
+  size_t min_msg_size, max_msg_size;
   int ntimes, stride;
   shmem_barrier_all();
 
   if (argc == 1) {
     if (mype == 0) {
+      display_logo();
       display_help();
     }
     shmem_finalize();
@@ -88,6 +82,7 @@ int main(int argc, char *argv[]) {
   shmem_barrier_all();
   if (opts.help) {
     if (mype == 0) {
+      display_logo();
       display_help();
     }
     shmem_finalize();
@@ -95,28 +90,73 @@ int main(int argc, char *argv[]) {
   }
 
   /**
-    Display header
+    Build the message-size schedule every sweep iterates
+  */
+  if (!size_schedule_build(&bench_sizes, opts.sizes, min_msg_size,
+                           max_msg_size, opts.size_factor, opts.size_step)) {
+    shmem_global_exit(EXIT_FAILURE);
+  }
+  min_msg_size = bench_sizes.min;
+  max_msg_size = bench_sizes.max;
+
+  /**
+    Cold runs rotate through buffer copies spanning more than the last-level
+    cache; every PE takes PE 0's size so the copies stay symmetric
+  */
+  if (opts.cache_cold && opts.cache_ring == 0) {
+    long *llc = (long *)shmem_malloc(sizeof(long));
+    if (llc == NULL) {
+      fprintf(stderr, "PE %d: shmem_malloc failed\n", mype);
+      shmem_global_exit(EXIT_FAILURE);
+    }
+    *llc = cache_llc_bytes();
+    shmem_barrier_all();
+    opts.cache_ring = shmem_long_g(llc, 0);
+    shmem_barrier_all();
+    shmem_free(llc);
+  }
+
+  /**
+    Open the result output (text, JSON Lines or CSV)
+  */
+  if (!report_open(&opts, name, version, npes, ntimes, stride,
+                   &bench_sizes)) {
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  /**
+    Calibrate the timer before anything is measured
+  */
+  timer_init(opts.timer, opts.subtract_overhead);
+
+  /**
+    Display logo and header (text output only)
   */
   shmem_barrier_all();
-  if (mype == 0) {
+  if (mype == 0 && report_is_text()) {
+    display_logo();
     display_header(name, version, npes, benchmark, benchtype, min_msg_size,
-                   max_msg_size, ntimes, stride);
+                   max_msg_size, ntimes, &opts);
   }
 
   /**
     Run benchmarks
   */
   shmem_barrier_all();
-  run_benchmark(benchmark, benchtype, min_msg_size, max_msg_size, ntimes,
-                stride);
+  run_benchmark(benchmark, benchtype, max_msg_size, ntimes, &opts);
 
   /**
     Finalize the program
   */
+  report_close();
   free(version);
   free(name);
   free(benchmark);
   free(benchtype);
+  free(opts.sizes);
+  free(opts.output_file);
+  free(opts.types);
+  size_schedule_free(&bench_sizes);
 
   shmem_finalize();
   return EXIT_SUCCESS;
@@ -0,0 +1,75 @@
+/**
+  @file ordering.c
+  @brief Completion and ordering semantics the point-to-point RMA
+  benchmarks can be forced to (see --ordering)
+*/
+
+#include "ordering.h"
+
+/**
+  @brief Parse the name of an ordering semantic
+  @param name "none", "fence-per-op", "quiet-per-op" or "quiet-per-window"
+  @param ordering Parsed semantic
+  @return True if the name is known, false otherwise
+ */
+bool ordering_parse(const char *name, ordering_t *ordering) {
+  if (strcmp(name, "none") == 0) {
+    *ordering = ORDERING_NONE;
+  } else if (strcmp(name, "fence-per-op") == 0) {
+    *ordering = ORDERING_FENCE_EACH;
+  } else if (strcmp(name, "quiet-per-op") == 0) {
+    *ordering = ORDERING_QUIET_EACH;
+  } else if (strcmp(name, "quiet-per-window") == 0) {
+    *ordering = ORDERING_QUIET_WINDOW;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+  @brief Parse a comma-separated list of ordering semantics
+  @param arg List to parse, e.g. "none,fence-per-op"
+  @param orderings Parsed semantics
+  @param max Most semantics the list may hold
+  @param count Number of semantics parsed
+  @return True if every name is known and the list is not too long
+ */
+bool ordering_parse_list(const char *arg, ordering_t *orderings, int max,
+                         int *count) {
+  char name[32];
+  *count = 0;
+  const char *p = arg;
+  while (*p != '\0') {
+    size_t len = strcspn(p, ",");
+    if (len == 0 || len >= sizeof(name) || *count == max) {
+      return false;
+    }
+    memcpy(name, p, len);
+    name[len] = '\0';
+    if (!ordering_parse(name, &orderings[*count])) {
+      return false;
+    }
+    (*count)++;
+    p += (p[len] == ',') ? len + 1 : len;
+  }
+  return *count > 0;
+}
+
+/**
+  @brief Get the name of an ordering semantic
+  @param ordering Ordering semantic
+  @return Name as accepted by --ordering
+ */
+const char *ordering_name(ordering_t ordering) {
+  switch (ordering) {
+  case ORDERING_FENCE_EACH:
+    return "fence-per-op";
+  case ORDERING_QUIET_EACH:
+    return "quiet-per-op";
+  case ORDERING_QUIET_WINDOW:
+    return "quiet-per-window";
+  default:
+    return "none";
+  }
+}
@@ -0,0 +1,171 @@
+/**
+  @file pairs.c
+  @brief PE pairing policies of the multi-pair point-to-point mode
+*/
+
+#include "pairs.h"
+
+/**
+  @brief Parse the name of a pairing policy
+  @param name "block", "interleaved", "intra" or "inter"
+  @param policy Parsed policy
+  @return True if the name is known, false otherwise
+ */
+bool pair_policy_parse(const char *name, pair_policy_t *policy) {
+  if (strcmp(name, "block") == 0) {
+    *policy = PAIRS_BLOCK;
+  } else if (strcmp(name, "interleaved") == 0) {
+    *policy = PAIRS_INTERLEAVED;
+  } else if (strcmp(name, "intra") == 0) {
+    *policy = PAIRS_INTRA;
+  } else if (strcmp(name, "inter") == 0) {
+    *policy = PAIRS_INTER;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+  @brief Get the name of a pairing policy
+  @param policy Pairing policy
+  @return Name as accepted by --pairs, or "none"
+ */
+const char *pair_policy_name(pair_policy_t policy) {
+  switch (policy) {
+  case PAIRS_BLOCK:
+    return "block";
+  case PAIRS_INTERLEAVED:
+    return "interleaved";
+  case PAIRS_INTRA:
+    return "intra";
+  case PAIRS_INTER:
+    return "inter";
+  default:
+    return "none";
+  }
+}
+
+/**
+  @brief Find the node of every PE, named by the lowest PE on it.
+  OpenSHMEM 1.5 uses SHMEM_TEAM_SHARED; 1.4 treats the PEs whose memory
+  shmem_ptr can reach as one node. Collective.
+  @param node Array of shmem_n_pes() entries receiving the node of each PE
+  @return True on success, false if the exchange buffer could not be
+  allocated
+ */
+static bool pairs_find_nodes(int *node) {
+  int npes = shmem_n_pes();
+  int mype = shmem_my_pe();
+
+  int *nodes = (int *)shmem_malloc(npes * sizeof(int));
+  if (nodes == NULL) {
+    return false;
+  }
+
+  int leader = mype;
+#if defined(USE_15)
+  int shared = shmem_team_n_pes(SHMEM_TEAM_SHARED);
+  for (int k = 0; k < shared; k++) {
+    int pe = shmem_team_translate_pe(SHMEM_TEAM_SHARED, k, SHMEM_TEAM_WORLD);
+    if (pe >= 0 && pe < leader) {
+      leader = pe;
+    }
+  }
+#elif defined(USE_14)
+  for (int pe = 0; pe < mype; pe++) {
+    if (shmem_ptr(nodes, pe) != NULL) {
+      leader = pe;
+      break;
+    }
+  }
+#endif
+
+  /* Everyone writes its node into every PE's copy */
+  for (int pe = 0; pe < npes; pe++) {
+    shmem_int_p(&nodes[mype], leader, pe);
+  }
+  shmem_barrier_all();
+
+  memcpy(node, nodes, npes * sizeof(int));
+  shmem_barrier_all();
+  shmem_free(nodes);
+  return true;
+}
+
+/**
+  @brief Pair every PE with the next unpaired PE on the same node (intra)
+  or on another node (inter)
+  @param node Node of every PE
+  @param npes Number of PEs
+  @param same_node True to pair within nodes, false to pair across them
+  @param partner Partner of every PE, -1 on entry
+  @return Number of pairs formed
+ */
+static int pairs_by_node(const int *node, int npes, bool same_node,
+                         int *partner) {
+  int pairs = 0;
+  for (int i = 0; i < npes; i++) {
+    if (partner[i] >= 0) {
+      continue;
+    }
+    for (int j = i + 1; j < npes; j++) {
+      if (partner[j] < 0 && (node[j] == node[i]) == same_node) {
+        partner[i] = j;
+        partner[j] = i;
+        pairs++;
+        break;
+      }
+    }
+  }
+  return pairs;
+}
+
+/**
+  @brief Split all PEs into pairs. Collective: every PE must call it and
+  every PE gets the same result. The lower PE of each pair is its
+  initiator; PEs that cannot be paired are left idle.
+  @param policy Pairing policy
+  @param partner Array of shmem_n_pes() entries receiving the partner of
+  every PE, or -1 for idle PEs
+  @return Number of pairs formed
+ */
+int pairs_build(pair_policy_t policy, int *partner) {
+  int npes = shmem_n_pes();
+  int pairs = 0;
+
+  for (int i = 0; i < npes; i++) {
+    partner[i] = -1;
+  }
+
+  switch (policy) {
+  case PAIRS_BLOCK:
+    for (int i = 0; i < npes / 2; i++) {
+      partner[i] = i + npes / 2;
+      partner[i + npes / 2] = i;
+      pairs++;
+    }
+    break;
+  case PAIRS_INTRA:
+  case PAIRS_INTER: {
+    int *node = (int *)malloc(npes * sizeof(int));
+    if (node == NULL || !pairs_find_nodes(node)) {
+      fprintf(stderr, "PE %d: Unable to find the node of every PE\n",
+              shmem_my_pe());
+      shmem_global_exit(1);
+    }
+    pairs = pairs_by_node(node, npes, policy == PAIRS_INTRA, partner);
+    free(node);
+    break;
+  }
+  default:
+    /* Interleaved; a 2-PE job is the single pair 0-1 */
+    for (int i = 0; i + 1 < npes; i += 2) {
+      partner[i] = i + 1;
+      partner[i + 1] = i;
+      pairs++;
+    }
+    break;
+  }
+  return pairs;
+}
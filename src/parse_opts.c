@@ -5,6 +5,73 @@
  */
 
 #include "parse_opts.h"
+#include "sizes.h"
+#include "types.h"
+
+/* Names --type accepts besides "all": the TYPENAME of every standard RMA
+   type, every fixed size in bits, and "mem" */
+#define TYPE_NAME(name, type, arg) #name,
+static const char *const type_names[] = {
+    BENCH_RMA_TYPES(TYPE_NAME, 0) BENCH_SIZED_TYPES(TYPE_NAME, 0) "mem"};
+#undef TYPE_NAME
+
+/**
+  @brief Parse a comma-separated list of counts > 0
+  @param arg Option argument, e.g. "1,16,64"
+  @param values Parsed counts
+  @param max Most counts the list may hold
+  @param count Number of counts parsed
+  @return True if every entry is a count > 0 and there are at most max
+ */
+static bool parse_count_list(const char *arg, int *values, int max,
+                             int *count) {
+  *count = 0;
+  const char *p = arg;
+  while (*p != '\0') {
+    char *end;
+    long v = strtol(p, &end, 10);
+    if (end == p || v <= 0 || v > INT_MAX || *count == max ||
+        (*end != ',' && *end != '\0')) {
+      return false;
+    }
+    values[(*count)++] = (int)v;
+    p = (*end == ',') ? end + 1 : end;
+  }
+  return *count > 0;
+}
+
+/**
+  @brief Check a comma-separated list of element types, each a name or glob
+  pattern matching at least one known type, or "all"
+  @param arg Option argument, e.g. "int,uint*,mem"
+  @return True if every entry matches a type
+ */
+static bool parse_type_list(const char *arg) {
+  char pattern[64];
+  const char *p = arg;
+  while (*p != '\0') {
+    size_t len = strcspn(p, ",");
+    if (len == 0 || len >= sizeof(pattern)) {
+      return false;
+    }
+    memcpy(pattern, p, len);
+    pattern[len] = '\0';
+
+    bool known = strcmp(pattern, "all") == 0;
+    int n = (int)(sizeof(type_names) / sizeof(type_names[0]));
+    for (int i = 0; i < n && !known; i++) {
+      known = fnmatch(pattern, type_names[i], 0) == 0;
+    }
+    if (!known) {
+      return false;
+    }
+    p += len;
+    if (*p == ',') {
+      p++;
+    }
+  }
+  return true;
+}
 
 /**
   @brief Parses runtime options
@@ -20,7 +87,7 @@
   @return True if parsing is successful, false otherwise.
  */
 bool parse_opts(int argc, char *argv[], options *opts, char **benchmark,
-                char **benchtype, int *min_msg_size, int *max_msg_size,
+                char **benchtype, size_t *min_msg_size, size_t *max_msg_size,
                 int *ntimes, int *stride) {
   /* Initialize all options to default values */
   memset(opts, 0, sizeof(*opts));
@@ -29,16 +96,52 @@ bool parse_opts(int argc, char *argv[], options *opts, char **benchmark,
   *min_msg_size = 8;
   *max_msg_size = 1024;
   *ntimes = 10;
-  *stride = 10;
+  *stride = DEFAULT_STRIDE;
+  opts->stride = DEFAULT_STRIDE;
+  opts->strides[0] = DEFAULT_STRIDE;
+  opts->num_strides = 1;
+  opts->windows[0] = DEFAULT_WINDOW;
+  opts->num_windows = 1;
+  parse_count_list("1,4,16,64", opts->chunks, MAX_CHUNKS, &opts->num_chunks);
+  opts->traffic[0] = TRAFFIC_UNIFORM;
+  opts->num_traffic = 1;
+  opts->traffic_reads = 1;
+  opts->traffic_writes = 1;
+  opts->zipf = DEFAULT_ZIPF;
 
   /* Define runtime options */
   static struct option long_options[] = {
       {"bench", required_argument, 0, 0},
       {"benchtype", required_argument, 0, 0},
+      {"type", required_argument, 0, 0},
       {"min", required_argument, 0, 0},
       {"max", required_argument, 0, 0},
       {"ntimes", required_argument, 0, 0},
       {"stride", required_argument, 0, 0},
+      {"window", required_argument, 0, 0},
+      {"chunks", required_argument, 0, 0},
+      {"ordering", required_argument, 0, 0},
+      {"traffic", required_argument, 0, 0},
+      {"rw-ratio", required_argument, 0, 0},
+      {"zipf", required_argument, 0, 0},
+      {"src-offset", required_argument, 0, 0},
+      {"dst-offset", required_argument, 0, 0},
+      {"pairs", required_argument, 0, 0},
+      {"sizes", required_argument, 0, 0},
+      {"size-factor", required_argument, 0, 0},
+      {"size-step", required_argument, 0, 0},
+      {"percentiles", no_argument, 0, 0},
+      {"warmup", required_argument, 0, 0},
+      {"timer", required_argument, 0, 0},
+      {"subtract-overhead", no_argument, 0, 0},
+      {"pe-table", no_argument, 0, 0},
+      {"target-ci", required_argument, 0, 0},
+      {"max-time", required_argument, 0, 0},
+      {"realloc-per-size", no_argument, 0, 0},
+      {"cache", required_argument, 0, 0},
+      {"cache-ring", required_argument, 0, 0},
+      {"output", required_argument, 0, 0},
+      {"output-file", required_argument, 0, 0},
       {"help", no_argument, 0, 0},
       {0, 0, 0, 0} /* Terminator */
   };
@@ -57,36 +160,48 @@ bool parse_opts(int argc, char *argv[], options *opts, char **benchmark,
         *benchmark = opts->bench;
       } else if (strcmp(option_name, "benchtype") == 0) {
         if (strcmp(optarg, "bw") == 0 || strcmp(optarg, "bibw") == 0 ||
-            strcmp(optarg, "latency") == 0) {
+            strcmp(optarg, "mr") == 0 || strcmp(optarg, "latency") == 0 ||
+            strcmp(optarg, "overlap") == 0 || strcmp(optarg, "pack") == 0 ||
+            strcmp(optarg, "align") == 0 || strcmp(optarg, "rma") == 0 ||
+            strcmp(optarg, "chase") == 0 || strcmp(optarg, "updates") == 0) {
           opts->benchtype = strdup(optarg);
           *benchtype = opts->benchtype;
         } else {
           if (shmem_my_pe() == 0) {
             fprintf(stderr,
                     "Invalid benchtype specified: %s. "
-                    "Must be 'bw', 'bibw', or 'latency'.\n",
+                    "Must be 'bw', 'bibw', 'mr', 'latency', 'overlap', "
+                    "'pack', 'align', 'rma', 'chase' or 'updates'.\n",
                     optarg);
           }
           return false;
         }
-      } else if (strcmp(option_name, "min") == 0) {
-        if (*benchmark && (strcmp(*benchmark, "shmem_barrier_all") != 0)) {
-          opts->min_msg_size = atoi(optarg);
-          if (opts->min_msg_size <= 0) {
-            opts->min_msg_size = 1; /* Set a default if not provided */
+      } else if (strcmp(option_name, "type") == 0) {
+        /* Typed variants of the typed RMA benchmarks, each its own run */
+        if (!parse_type_list(optarg)) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid type specified: %s. Must be comma-separated "
+                    "RMA type names, sizes in bits, 'mem' or 'all'.\n",
+                    optarg);
           }
-          *min_msg_size = opts->min_msg_size;
+          return false;
         }
+        free(opts->types);
+        opts->types = strdup(optarg);
+      } else if (strcmp(option_name, "min") == 0) {
+        /* Size-less benchmarks (atomics, barrier) simply ignore the sizes */
+        if (!size_parse(optarg, &opts->min_msg_size, NULL)) {
+          opts->min_msg_size = 1; /* Set a default if not provided */
+        }
+        *min_msg_size = opts->min_msg_size;
       } else if (strcmp(option_name, "max") == 0) {
-        if (*benchmark && (strcmp(*benchmark, "shmem_barrier_all") != 0)) {
-          opts->max_msg_size = atoi(optarg);
-          if (opts->max_msg_size <= 0 ||
-              opts->max_msg_size < opts->min_msg_size) {
-            opts->max_msg_size =
-                *min_msg_size * 128; /* Set a default max if invalid */
-          }
-          *max_msg_size = opts->max_msg_size;
+        if (!size_parse(optarg, &opts->max_msg_size, NULL) ||
+            opts->max_msg_size < opts->min_msg_size) {
+          opts->max_msg_size =
+              *min_msg_size * 128; /* Set a default max if invalid */
         }
+        *max_msg_size = opts->max_msg_size;
       } else if (strcmp(option_name, "ntimes") == 0) {
         opts->ntimes = atoi(optarg);
         if (opts->ntimes <= 0) {
@@ -94,14 +209,233 @@ bool parse_opts(int argc, char *argv[], options *opts, char **benchmark,
         }
         *ntimes = opts->ntimes;
       } else if (strcmp(option_name, "stride") == 0) {
-        if (*benchmark && (strcmp(*benchmark, "shmem_iput") == 0 ||
-                           strcmp(*benchmark, "shmem_iget") == 0)) {
-          opts->stride = atoi(optarg);
-          if (opts->stride <= 0) {
-            opts->stride = 10; /* Default to 10 if not provided */
+        /* Comma-separated strides, each run as its own sweep of the
+           strided benchmarks */
+        if (!parse_count_list(optarg, opts->strides, MAX_STRIDES,
+                              &opts->num_strides)) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid stride specified: %s. Must be up to %d "
+                    "comma-separated strides > 0.\n",
+                    optarg, MAX_STRIDES);
+          }
+          return false;
+        }
+        opts->stride = opts->strides[0];
+        *stride = opts->stride;
+      } else if (strcmp(option_name, "window") == 0) {
+        /* Comma-separated windows, each run as its own sweep */
+        if (!parse_count_list(optarg, opts->windows, MAX_WINDOWS,
+                              &opts->num_windows)) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid window specified: %s. Must be up to %d "
+                    "comma-separated counts > 0.\n",
+                    optarg, MAX_WINDOWS);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "chunks") == 0) {
+        /* Comma-separated piece counts, each run as its own sweep */
+        if (!parse_count_list(optarg, opts->chunks, MAX_CHUNKS,
+                              &opts->num_chunks)) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid chunks specified: %s. Must be up to %d "
+                    "comma-separated counts > 0.\n",
+                    optarg, MAX_CHUNKS);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "ordering") == 0) {
+        /* Comma-separated semantics, each run as its own sweep */
+        if (!ordering_parse_list(optarg, opts->orderings, MAX_ORDERINGS,
+                                 &opts->num_orderings)) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid ordering specified: %s. Must be up to %d of "
+                    "'none', 'fence-per-op', 'quiet-per-op' and "
+                    "'quiet-per-window', comma-separated.\n",
+                    optarg, MAX_ORDERINGS);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "traffic") == 0) {
+        /* Comma-separated distributions, each run as its own sweep */
+        if (!traffic_parse_list(optarg, opts->traffic, MAX_TRAFFIC,
+                                &opts->num_traffic)) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid traffic specified: %s. Must be up to %d of "
+                    "'uniform', 'zipf', 'neighbor' and 'permutation', "
+                    "comma-separated.\n",
+                    optarg, MAX_TRAFFIC);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "rw-ratio") == 0) {
+        if (!traffic_parse_ratio(optarg, &opts->traffic_reads,
+                                 &opts->traffic_writes)) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid read:write ratio specified: %s. Must be "
+                    "<reads>:<writes>, e.g. 3:1, not both 0.\n",
+                    optarg);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "zipf") == 0) {
+        char *end;
+        opts->zipf = strtod(optarg, &end);
+        if (end == optarg || *end != '\0' || opts->zipf <= 0.0) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid zipf exponent specified: %s. Must be > 0.\n",
+                    optarg);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "src-offset") == 0 ||
+                 strcmp(option_name, "dst-offset") == 0) {
+        /* Bytes the buffers of the contiguous byte benchmarks start past
+           their well-aligned allocation */
+        char *end;
+        long offset = strtol(optarg, &end, 10);
+        if (end == optarg || *end != '\0' || offset < 0 ||
+            offset > MAX_OFFSET) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid %s specified: %s. Must be 0 to %d bytes.\n",
+                    option_name, optarg, MAX_OFFSET);
+          }
+          return false;
+        }
+        if (option_name[0] == 's') {
+          opts->src_offset = (int)offset;
+        } else {
+          opts->dst_offset = (int)offset;
+        }
+      } else if (strcmp(option_name, "pairs") == 0) {
+        if (!pair_policy_parse(optarg, &opts->pairs)) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid pairing policy specified: %s. "
+                    "Must be 'block', 'interleaved', 'intra', or 'inter'.\n",
+                    optarg);
           }
-          *stride = opts->stride;
+          return false;
+        }
+      } else if (strcmp(option_name, "sizes") == 0) {
+        free(opts->sizes);
+        opts->sizes = strdup(optarg);
+      } else if (strcmp(option_name, "size-factor") == 0) {
+        opts->size_factor = atof(optarg);
+        if (opts->size_factor <= 1.0) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid size factor specified: %s. Must be > 1.\n",
+                    optarg);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "size-step") == 0) {
+        if (!size_parse(optarg, &opts->size_step, NULL)) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid size step specified: %s. Must be > 0.\n",
+                    optarg);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "percentiles") == 0) {
+        opts->percentiles = true;
+      } else if (strcmp(option_name, "warmup") == 0) {
+        if (strcmp(optarg, "auto") == 0) {
+          opts->warmup_auto = true;
+        } else {
+          opts->warmup = atoi(optarg);
+          if (opts->warmup < 0) {
+            opts->warmup = 0;
+          }
+        }
+      } else if (strcmp(option_name, "timer") == 0) {
+        if (strcmp(optarg, "auto") == 0) {
+          opts->timer = TIMER_AUTO;
+        } else if (strcmp(optarg, "cycles") == 0) {
+          opts->timer = TIMER_CYCLES;
+        } else if (strcmp(optarg, "clock") == 0) {
+          opts->timer = TIMER_CLOCK_GETTIME;
+        } else {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid timer specified: %s. "
+                    "Must be 'auto', 'cycles', or 'clock'.\n",
+                    optarg);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "subtract-overhead") == 0) {
+        opts->subtract_overhead = true;
+      } else if (strcmp(option_name, "pe-table") == 0) {
+        opts->pe_table = true;
+      } else if (strcmp(option_name, "target-ci") == 0) {
+        opts->target_ci = atof(optarg);
+        if (opts->target_ci < 0.0) {
+          opts->target_ci = 0.0;
+        }
+      } else if (strcmp(option_name, "max-time") == 0) {
+        opts->max_time = atof(optarg);
+        if (opts->max_time < 0.0) {
+          opts->max_time = 0.0;
+        }
+      } else if (strcmp(option_name, "realloc-per-size") == 0) {
+        opts->realloc_per_size = true;
+      } else if (strcmp(option_name, "cache") == 0) {
+        if (strcmp(optarg, "cold") == 0) {
+          opts->cache_cold = true;
+        } else if (strcmp(optarg, "warm") == 0) {
+          opts->cache_cold = false;
+        } else {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid cache mode specified: %s. "
+                    "Must be 'cold' or 'warm'.\n",
+                    optarg);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "cache-ring") == 0) {
+        /* Bytes the buffer copies of cold runs rotate through */
+        char *end;
+        long ring = strtol(optarg, &end, 10);
+        if (end == optarg || *end != '\0' || ring <= 0) {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid cache ring specified: %s. Must be > 0 bytes.\n",
+                    optarg);
+          }
+          return false;
         }
+        opts->cache_ring = ring;
+      } else if (strcmp(option_name, "output") == 0) {
+        if (strcmp(optarg, "text") == 0) {
+          opts->output = OUTPUT_TEXT;
+        } else if (strcmp(optarg, "json") == 0) {
+          opts->output = OUTPUT_JSON;
+        } else if (strcmp(optarg, "csv") == 0) {
+          opts->output = OUTPUT_CSV;
+        } else {
+          if (shmem_my_pe() == 0) {
+            fprintf(stderr,
+                    "Invalid output format specified: %s. "
+                    "Must be 'text', 'json', or 'csv'.\n",
+                    optarg);
+          }
+          return false;
+        }
+      } else if (strcmp(option_name, "output-file") == 0) {
+        free(opts->output_file);
+        opts->output_file = strdup(optarg);
       } else if (strcmp(option_name, "help") == 0) {
         opts->help = true;
       } else {
@@ -112,44 +446,23 @@ bool parse_opts(int argc, char *argv[], options *opts, char **benchmark,
     }
   }
 
-  /* Set default benchtype if not provided by user */
-  if (*benchtype == NULL || strlen(*benchtype) == 0) {
-    if (*benchmark != NULL) {
-      /* Atomics: default to latency */
-      if (strstr(*benchmark, "atomic") != NULL) {
-        opts->benchtype = strdup("latency");
-        *benchtype = opts->benchtype;
-      }
-      /* Barrier: default to latency */
-      else if (strcmp(*benchmark, "shmem_barrier_all") == 0) {
-        opts->benchtype = strdup("latency");
-        *benchtype = opts->benchtype;
-      }
-      /* Collectives and pt2pt RMA: default to bw */
-      else if (strcmp(*benchmark, "shmem_put") == 0 ||
-               strcmp(*benchmark, "shmem_putmem") == 0 ||
-               strcmp(*benchmark, "shmem_iput") == 0 ||
-               strcmp(*benchmark, "shmem_get") == 0 ||
-               strcmp(*benchmark, "shmem_getmem") == 0 ||
-               strcmp(*benchmark, "shmem_iget") == 0 ||
-               strcmp(*benchmark, "shmem_put_nbi") == 0 ||
-               strcmp(*benchmark, "shmem_putmem_nbi") == 0 ||
-               strcmp(*benchmark, "shmem_get_nbi") == 0 ||
-               strcmp(*benchmark, "shmem_getmem_nbi") == 0 ||
-               strcmp(*benchmark, "shmem_alltoall") == 0 ||
-               strcmp(*benchmark, "shmem_alltoallmem") == 0 ||
-               strcmp(*benchmark, "shmem_alltoalls") == 0 ||
-               strcmp(*benchmark, "shmem_alltoallsmem") == 0 ||
-               strcmp(*benchmark, "shmem_broadcast") == 0 ||
-               strcmp(*benchmark, "shmem_broadcastmem") == 0 ||
-               strcmp(*benchmark, "shmem_collectmem") == 0 ||
-               strcmp(*benchmark, "shmem_collect") == 0 ||
-               strcmp(*benchmark, "shmem_fcollect") == 0 ||
-               strcmp(*benchmark, "shmem_fcollectmem") == 0) {
-        opts->benchtype = strdup("bw");
-        *benchtype = opts->benchtype;
-      }
+  /* A schedule is either a list, geometric or linear */
+  int schedules = (opts->sizes != NULL) + (opts->size_factor > 0.0) +
+                  (opts->size_step > 0);
+  if (schedules > 1) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr, "Only one of --sizes, --size-factor and --size-step "
+                      "can be given.\n");
     }
+    return false;
+  }
+
+  /* Without --benchtype every benchmark runs its default benchtype */
+  if (*benchmark == NULL && !opts->help) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr, "No benchmark specified. Use --bench <routine>.\n");
+    }
+    return false;
   }
 
   return true;
@@ -168,7 +481,10 @@ void display_help() {
          "--benchtype <type> [options]\n");
 
   printf("\nRequired Options:\n");
-  printf("  --bench <routine>      Specify the routine to benchmark\n");
+  printf("  --bench <routine>      Specify the routine(s) to benchmark: a name, a\n");
+  printf("                         comma-separated list, glob patterns such as\n");
+  printf("                         'shmem_atomic_*', or 'all'. Every match runs in\n");
+  printf("                         its own section of a single launch.\n");
   printf("                          Available options:\n");
   printf("                            shmem_put\n");
   printf("                            shmem_putmem\n");
@@ -180,6 +496,21 @@ void display_help() {
   printf("                            shmem_putmem_nbi\n");
   printf("                            shmem_get_nbi\n");
   printf("                            shmem_getmem_nbi\n");
+  printf("                            shmem_putmem_chunked\n");
+  printf("                            shmem_getmem_chunked\n");
+  printf("                            shmem_p\n");
+  printf("                            shmem_g\n");
+  printf("                            shmem_putmem_packed\n");
+  printf("                            shmem_getmem_unpacked\n");
+  printf("                            shmem_ptr_memcpy\n");
+  printf("                            shmem_ptr_stream\n");
+  printf("                            shmem_ptr_scalar\n");
+  printf("                            shmem_put_signal\n");
+  printf("                            shmem_put_signal_nbi\n");
+  printf("                            shmem_signal_fetch\n");
+  printf("                            shmem_put_fence_set\n");
+  printf("                            shmem_traffic\n");
+  printf("                            shmem_traffic_pg\n");
   printf("\n");
   printf("                            shmem_alltoall\n");
   printf("                            shmem_alltoallmem\n");
@@ -201,35 +532,230 @@ void display_help() {
   printf("                            shmem_atomic_set\n");
   printf("                            shmem_atomic_swap\n");
   printf("\n");
-  printf("  --benchtype <type>     Set the benchmark type (bw, bibw, latency)\n");
+  printf("  --benchtype <type>     Set the benchmark type (bw, bibw, mr, latency, overlap, pack, align, rma, chase, updates)\n");
   printf("                           Pt2pt RMA benchmarks support 'bw' (default) and 'bibw'.\n");
   printf("                             - Both 'bw' and 'bibw' benchmarks also report latency results.\n");
+  printf("                           The nbi RMA benchmarks also support 'mr' (message rate).\n");
+  printf("                           shmem_put and shmem_putmem also support 'latency': a\n");
+  printf("                           ping-pong with flag polling, reporting half the round trip.\n");
+  printf("                           shmem_put_signal, shmem_put_signal_nbi and their\n");
+  printf("                           put + fence + atomic_set baseline shmem_put_fence_set\n");
+  printf("                           support 'bw' (default), 'bibw', 'latency' and 'mr';\n");
+  printf("                           shmem_signal_fetch supports 'latency' only.\n");
+  printf("                           The signal benchmarks need OpenSHMEM 1.5.\n");
+  printf("                           shmem_put_nbi, shmem_get_nbi, shmem_put_signal_nbi and\n");
+  printf("                           shmem_atomic_fetch_nbi also support 'overlap': compute\n");
+  printf("                           as long as the transfer alone takes between issue and\n");
+  printf("                           shmem_quiet, and report how much of it was hidden.\n");
+  printf("                           shmem_iput and shmem_iget also support 'pack': each size\n");
+  printf("                           is timed side by side with shmem_putmem_packed or\n");
+  printf("                           shmem_getmem_unpacked, reporting the crossover point.\n");
+  printf("                           shmem_putmem, shmem_getmem and their _nbi forms also\n");
+  printf("                           support 'align': one sweep per source and destination\n");
+  printf("                           offset of 0, 1, 2, 4, 8, 16, 32, 63 and 64 bytes, then\n");
+  printf("                           the bandwidth penalty of every offset at every size.\n");
+  printf("                           shmem_ptr_memcpy, shmem_ptr_stream and shmem_ptr_scalar copy\n");
+  printf("                           straight into the peer through shmem_ptr (memcpy, AVX-512,\n");
+  printf("                           AVX2 or SSE2 non-temporal stores picked at run time, or\n");
+  printf("                           a scalar load/store loop); they support 'bw' (default),\n");
+  printf("                           'bibw' and 'rma', which times each size side by side with\n");
+  printf("                           shmem_putmem. They are skipped unless every peer is\n");
+  printf("                           reachable through shmem_ptr (PEs on the same node).\n");
+  printf("                           shmem_putmem_chunked and shmem_getmem_chunked split each\n");
+  printf("                           transfer into --chunks shmem_putmem_nbi/shmem_getmem_nbi\n");
+  printf("                           pieces in flight at once, completed by one shmem_quiet,\n");
+  printf("                           and support 'bw' (default) and 'bibw'.\n");
+  printf("                           shmem_p and shmem_g time single elements: 'latency'\n");
+  printf("                           (default) is a ping-pong of shmem_long_p with flag polling\n");
+  printf("                           (half the round trip) or the blocking round trip of\n");
+  printf("                           shmem_long_g, and 'mr' is every PE issuing back to back to\n");
+  printf("                           random PEs (one shmem_quiet per batch for shmem_p). Both are\n");
+  printf("                           timed side by side with a one-element shmem_long_put or\n");
+  printf("                           shmem_long_get, and every standard type runs with --type.\n");
+  printf("                           shmem_g and shmem_getmem support 'chase': PE 0 follows one\n");
+  printf("                           random cycle through 64-byte nodes spread over all other\n");
+  printf("                           PEs, each shmem_long_g or shmem_getmem returning the PE and\n");
+  printf("                           node of the next, and reports ns per dependent load. The\n");
+  printf("                           message size is the working set on each PE, from L1-sized\n");
+  printf("                           to DRAM-sized (raise SHMEM_SYMMETRIC_SIZE for large ones).\n");
+  printf("                           shmem_traffic and shmem_traffic_pg support 'updates': every\n");
+  printf("                           PE reads and writes slots of a 4 MiB region on the PEs of\n");
+  printf("                           the --traffic distribution, in the --rw-ratio mix, with\n");
+  printf("                           shmem_putmem_nbi/shmem_getmem_nbi of the message size or\n");
+  printf("                           shmem_long_p/shmem_long_g, and reports the updates per\n");
+  printf("                           second of all PEs together. Targets and offsets are\n");
+  printf("                           drawn before the timed loop.\n");
   printf("                           Collectives benchmarks support 'bw' (default).\n");
   printf("                             - The 'bw' benchmark also reports latency results.\n");
   printf("                           Atomic benchmarks only support 'latency' (default).\n");
+  printf("                           Without --benchtype each selected benchmark runs its default.\n");
   printf("\nOptional Parameters:\n");
-  printf("  --min <size>           Minimum message size in bytes (default: 1)\n");
+  printf("  --type <list>          Element types of the typed RMA benchmarks (shmem_put,\n");
+  printf("                         shmem_get, shmem_put_nbi, shmem_get_nbi, shmem_iput and\n");
+  printf("                         shmem_iget 'bw' and 'bibw', shmem_p and shmem_g 'latency'\n");
+  printf("                         and 'mr'), each run as its own\n");
+  printf("                         benchmark: comma-separated TYPENAMEs of the spec's\n");
+  printf("                         standard RMA types (float, double, longdouble, char,\n");
+  printf("                         schar, short, int, long, longlong, uchar, ushort, uint,\n");
+  printf("                         ulong, ulonglong, int8..int64, uint8..uint64, size,\n");
+  printf("                         ptrdiff), sizes in bits of the fixed-size routines\n");
+  printf("                         (8, 16, 32, 64, 128, e.g. shmem_put64), 'mem'\n");
+  printf("                         (shmem_putmem), glob patterns (e.g. 'uint*') or 'all'.\n");
+  printf("                         Sizes are rounded to whole elements of each type.\n");
+  printf("                         With more than one type a type comparison table\n");
+  printf("                         follows (default: long only)\n");
+  printf("\n");
+  printf("  --min <size>           Minimum message size in bytes, with an optional K, M, G\n");
+  printf("                         or T suffix (powers of 1024), e.g. 4K (default: 1)\n");
   printf("                            Note: Not applicable for atomic benchmarks.\n");
   printf("                            Note: Not applicable for shmem_barrier_all benchmark.\n");
   printf("\n");
-  printf("  --max <size>           Maximum message size in bytes (default: 1024)\n");
+  printf("  --max <size>           Maximum message size in bytes, with the same suffixes,\n");
+  printf("                         e.g. 16G (default: 1024)\n");
   printf("                            Note: Not applicable for atomic benchmarks.\n");
   printf("                            Note: Not applicable for shmem_barrier_all benchmark.\n");
   printf("\n");
   printf("  --ntimes <count>       Number of repetitions.\n");
   printf("                         Average among them is reported (default: 10)\n");
   printf("\n");
-  printf("  --stride <value>       Stride value for strided operations, only used by\n");
-  printf("                         the shmem_iput and shmem_iget (default: 10)\n");
+  printf("  --stride <list>        Stride in elements of the strided benchmarks\n");
+  printf("                         (shmem_iput, shmem_iget and their packed variants);\n");
+  printf("                         a comma-separated list runs one sweep per stride,\n");
+  printf("                         giving a stride x element-count grid (default: 10)\n");
+  printf("\n");
+  printf("  --window <list>        Non-blocking operations issued back to back per\n");
+  printf("                         shmem_quiet by the 'mr' benchmarks; a comma-separated\n");
+  printf("                         list runs one sweep per window (default: 64)\n");
+  printf("\n");
+  printf("  --chunks <list>        Pieces shmem_putmem_chunked and shmem_getmem_chunked\n");
+  printf("                         split each transfer into; a comma-separated list runs\n");
+  printf("                         one sweep per chunking (default: 1,4,16,64)\n");
+  printf("\n");
+  printf("  --ordering <list>      Force the completion of the point-to-point RMA\n");
+  printf("                         benchmarks to one or more comma-separated semantics,\n");
+  printf("                         each run as its own sweep:\n");
+  printf("                           none              one shmem_quiet per batch\n");
+  printf("                           fence-per-op      shmem_fence after every operation\n");
+  printf("                           quiet-per-op      shmem_quiet after every operation\n");
+  printf("                           quiet-per-window  shmem_quiet after every --window\n");
+  printf("                                             operations\n");
+  printf("                         With more than one, a table of the time per operation\n");
+  printf("                         of each at every size follows, with its extra cost\n");
+  printf("                         against the first. Latency, overlap and shmem_ptr\n");
+  printf("                         benchmarks keep their own completion (default: each\n");
+  printf("                         benchmark's own)\n");
+  printf("\n");
+  printf("  --traffic <list>       Where the accesses of the traffic benchmarks go, one or\n");
+  printf("                         more comma-separated distributions, each run as its own\n");
+  printf("                         sweep (default: uniform):\n");
+  printf("                           uniform      any PE and slot, equally likely\n");
+  printf("                           zipf         PE k and slot k with weight\n");
+  printf("                                        1 / (k + 1)^s: PE 0 and slot 0 are\n");
+  printf("                                        the hotspot\n");
+  printf("                           neighbor     the next and previous PE in turn,\n");
+  printf("                                        streaming through their slots\n");
+  printf("                           permutation  one fixed partner per PE, its slots\n");
+  printf("                                        in one fixed random order\n");
+  printf("\n");
+  printf("  --rw-ratio <R:W>       Reads to writes of the traffic benchmarks, e.g. 3:1 or\n");
+  printf("                         0:1 for writes only (default: 1:1)\n");
+  printf("\n");
+  printf("  --zipf <s>             Exponent s of the zipf distribution (default: 0.99)\n");
+  printf("\n");
+  printf("  --src-offset <bytes>   Start the source of shmem_putmem, shmem_getmem and their\n");
+  printf("                         _nbi forms this many bytes past its aligned buffer,\n");
+  printf("                         up to 4095 (default: 0)\n");
+  printf("\n");
+  printf("  --dst-offset <bytes>   Same for the destination (default: 0)\n");
+  printf("\n");
+  printf("  --pairs <policy>       Run the point-to-point RMA benchmarks on every pair\n");
+  printf("                         of PEs at once instead of requiring 2 PEs, and report\n");
+  printf("                         per-pair and aggregate bandwidth and message rate:\n");
+  printf("                           block        PE i with PE i + npes/2\n");
+  printf("                           interleaved  PE 2k with PE 2k+1\n");
+  printf("                           intra        PEs of the same node\n");
+  printf("                           inter        PEs of different nodes\n");
+  printf("\n");
+  printf("  --sizes <list>         Comma-separated message sizes in bytes, e.g.\n");
+  printf("                         8,24,4000 or 1M,1G (replaces --min and --max)\n");
+  printf("\n");
+  printf("  --size-factor <f>      Grow the message size by f (> 1) from --min to --max,\n");
+  printf("                         rounded to whole bytes (default: 2)\n");
+  printf("\n");
+  printf("  --size-step <size>     Grow the message size linearly by this many bytes\n");
+  printf("                         from --min to --max instead\n");
+  printf("\n");
+  printf("  --percentiles          Time every operation into a preallocated per-PE\n");
+  printf("                         buffer and report min/p50/p90/p99/p99.9/max and\n");
+  printf("                         stddev per message size (default: off)\n");
+  printf("\n");
+  printf("  --warmup <N|auto>      Untimed iterations run before timing each message\n");
+  printf("                         size. 'auto' keeps warming up until consecutive\n");
+  printf("                         window means agree within 5%% (default: 0)\n");
+  printf("\n");
+  printf("  --timer <backend>      Timer backend: 'cycles' (rdtscp / cntvct_el0,\n");
+  printf("                         calibrated at startup), 'clock' (clock_gettime),\n");
+  printf("                         or 'auto' to use cycles when invariant (default: auto)\n");
+  printf("\n");
+  printf("  --subtract-overhead    Subtract the measured timer read overhead from\n");
+  printf("                         per-operation results (default: off)\n");
+  printf("\n");
+  printf("  --pe-table             Also print every PE's time per message size and\n");
+  printf("                         flag PEs 25%% slower than the median (default: off)\n");
+  printf("\n");
+  printf("  --target-ci <pct>      Time batches of --ntimes operations per message size\n");
+  printf("                         until the 95%% confidence interval of the mean is\n");
+  printf("                         within <pct> percent of it (default: off, 1 with\n");
+  printf("                         --max-time)\n");
+  printf("\n");
+  printf("  --max-time <sec>       Time budget per message size for --target-ci\n");
+  printf("                         (default: off, 1 with --target-ci)\n");
+  printf("\n");
+  printf("  --realloc-per-size     shmem_malloc and shmem_free the buffers at every\n");
+  printf("                         message size instead of reusing buffers allocated\n");
+  printf("                         once at the largest size (default: off)\n");
+  printf("\n");
+  printf("  --cache <mode>         'warm' (default) reuses the same buffers for every\n");
+  printf("                         operation. 'cold' rotates the sized RMA and collective\n");
+  printf("                         benchmarks through copies of their buffers spanning\n");
+  printf("                         more than the last-level cache, and evicts the copies\n");
+  printf("                         of each batch (clflushopt or clflush on x86) before\n");
+  printf("                         the batch is timed.\n");
+  printf("\n");
+  printf("  --cache-ring <bytes>   Bytes the copies of --cache cold span (default: the\n");
+  printf("                         last-level cache size of PE 0). Source and destination\n");
+  printf("                         each take about this much symmetric memory; lower it\n");
+  printf("                         or raise SHMEM_SYMMETRIC_SIZE if allocation fails.\n");
+  printf("\n");
+  printf("  --output <format>      Result format: 'text', 'json' (one JSON object per\n");
+  printf("                         result row) or 'csv' (default: text)\n");
+  printf("\n");
+  printf("  --output-file <path>   Write results to <path> instead of stdout\n");
   printf("\n");
   printf("  --help                 Display this help message\n");
 
   printf("\nExample Usage:\n");
   printf("   oshrun -np 2 shmembench --bench shmem_put --benchtype bw --min 128 --max 1024 --ntimes 20\n");
   printf("   oshrun -np 2 shmembench --bench shmem_iget --benchtype bw --min 128 --max 1024 --ntimes 20 --stride 20\n");
+  printf("   oshrun -np 2 shmembench --bench shmem_put_nbi --benchtype mr --window 1,16,64\n");
+  printf("   oshrun -np 2 shmembench --bench shmem_iput --benchtype pack --stride 2,4,16,64\n");
+  printf("   oshrun -np 2 shmembench --bench shmem_put,shmem_get --type all --max 65536\n");
+  printf("   oshrun -np 2 shmembench --bench 'shmem_putmem*,shmem_getmem*' --benchtype align --max 65536\n");
+  printf("   oshrun -np 2 shmembench --bench 'shmem_ptr_*' --benchtype rma --max 1048576\n");
+  printf("   oshrun -np 2 shmembench --bench shmem_putmem,shmem_broadcast --cache cold --max 1048576\n");
+  printf("   oshrun -np 2 shmembench --bench shmem_getmem_chunked --min 1G --max 16G --chunks 1,8,64\n");
+  printf("   oshrun -np 2 shmembench --bench shmem_putmem,shmem_getmem --ordering none,fence-per-op,quiet-per-op\n");
+  printf("   oshrun -np 2 shmembench --bench shmem_p,shmem_g --type int,long,double\n");
+  printf("   oshrun -np 8 shmembench --bench shmem_p,shmem_g --benchtype mr --ntimes 100000\n");
+  printf("   oshrun -np 4 shmembench --bench shmem_g --benchtype chase --min 4K --max 256M --size-factor 4 --ntimes 10000\n");
+  printf("   oshrun -np 16 shmembench --bench 'shmem_traffic*' --traffic uniform,zipf,neighbor --rw-ratio 3:1 --max 4K\n");
+  printf("   oshrun -np 48 shmembench --bench shmem_put,shmem_get --pairs interleaved\n");
   printf("   oshrun -np 64 shmembench --bench shmem_broadcast --benchtype bw --min 128 --max 1024 --ntimes 20\n");
   printf("   oshrun -np 64 shmembench --bench shmem_barrier_all --benchtype latency --ntimes 100\n");
   printf("   oshrun -np 6 shmembench --bench shmem_atomic_add --benchtype latency --ntimes 100\n");
+  printf("   oshrun -np 2 shmembench --bench 'shmem_put*,shmem_atomic_*' --ntimes 100\n");
+  printf("   oshrun -np 2 shmembench --bench all\n");
+  printf("   oshrun -np 2 shmembench --bench all --output json --output-file results.jsonl\n");
   printf("\n");
 }
 /* clang-format on */
@@ -0,0 +1,1054 @@
+/**
+  @file report.c
+  @brief Single result emitter behind the text, JSON Lines and CSV output
+*/
+
+#include "report.h"
+
+/* Output settings and the run configuration repeated in every record */
+static struct {
+  output_format_t format; /* Selected --output format */
+  FILE *out;              /* Destination of the results */
+  bool own_file;          /* out was opened from --output-file */
+  bool csv_header;        /* The CSV header line has been written */
+  bool adaptive;          /* --target-ci/--max-time are in effect */
+  const options *opts;    /* Parsed runtime options */
+  const char *lib_name;   /* OpenSHMEM library name */
+  const char *lib_version; /* OpenSHMEM library version */
+  int npes;               /* Number of PEs */
+  int ntimes;             /* Operations timed per batch */
+  int stride;             /* Stride of the strided benchmarks */
+  char sizes[64];         /* Description of the message-size schedule */
+} report = {OUTPUT_TEXT, NULL, false, false, false, NULL, "", "", 0, 0, 0, ""};
+
+/**
+  @brief Set up the emitter; only PE 0 writes results
+  @param opts Parsed runtime options (output format, file, configuration)
+  @param lib_name Name of the OpenSHMEM library
+  @param lib_version Version of the OpenSHMEM library
+  @param npes Number of PEs
+  @param ntimes Operations timed per batch
+  @param stride Stride of the strided benchmarks
+  @param sizes Message-size schedule of the run
+  @return True on success, false if the output file could not be opened
+ */
+bool report_open(const options *opts, const char *lib_name,
+                 const char *lib_version, int npes, int ntimes, int stride,
+                 const size_schedule_t *sizes) {
+  report.format = opts->output;
+  report.out = stdout;
+  report.own_file = false;
+  report.csv_header = false;
+  report.adaptive = opts->target_ci > 0.0 || opts->max_time > 0.0;
+  report.opts = opts;
+  report.lib_name = (lib_name != NULL) ? lib_name : "";
+  report.lib_version = (lib_version != NULL) ? lib_version : "";
+  report.npes = npes;
+  report.ntimes = ntimes;
+  report.stride = stride;
+  size_schedule_describe(sizes, report.sizes, sizeof(report.sizes));
+
+  if (opts->output_file != NULL && shmem_my_pe() == 0) {
+    report.out = fopen(opts->output_file, "w");
+    if (report.out == NULL) {
+      fprintf(stderr, "Unable to open output file: %s\n", opts->output_file);
+      report.out = stdout;
+      return false;
+    }
+    report.own_file = true;
+  }
+  return true;
+}
+
+/**
+  @brief Flush and close the output file, if any
+ */
+void report_close(void) {
+  if (report.own_file) {
+    fclose(report.out);
+  } else if (report.out != NULL) {
+    fflush(report.out);
+  }
+  report.out = stdout;
+  report.own_file = false;
+}
+
+/**
+  @brief Get the stream results are written to
+  @return The --output-file stream, or stdout
+ */
+FILE *report_stream(void) {
+  return (report.out != NULL) ? report.out : stdout;
+}
+
+/**
+  @brief Check whether human-readable decorations (logo, header, section
+  banners) belong in the output
+  @return True for text output, false for JSON Lines and CSV
+ */
+bool report_is_text(void) { return report.format == OUTPUT_TEXT; }
+
+/**
+  @brief Print every active PE's time per row, flagging stragglers
+  @param out Stream to write to
+  @param rows Result rows carrying pe_times
+  @param num_rows Number of rows
+ */
+static void report_text_pe_table(FILE *out, const report_row_t *rows,
+                                 int num_rows) {
+  double *active = (double *)malloc(report.npes * sizeof(double));
+  if (active == NULL) {
+    return;
+  }
+
+  fprintf(out, "==============================================\n");
+  fprintf(out, "===        Per-PE Timing and Skew          ===\n");
+  fprintf(out, "==============================================\n");
+  fprintf(out, "%-16s %-8s %-14s %-12s\n", "Message Size", "PE", "Time (us)",
+          "vs Median");
+
+  for (int i = 0; i < num_rows; i++) {
+    const double *row = rows[i].pe_times;
+
+    /* Median over the PEs that actually issued operations */
+    int n = 0;
+    for (int pe = 0; pe < report.npes; pe++) {
+      if (row[pe] >= 0.0) {
+        active[n++] = row[pe];
+      }
+    }
+    if (n == 0) {
+      continue;
+    }
+    for (int a = 1; a < n; a++) {
+      for (int b = a; b > 0 && active[b - 1] > active[b]; b--) {
+        double tmp = active[b];
+        active[b] = active[b - 1];
+        active[b - 1] = tmp;
+      }
+    }
+    double median = percentile_sorted(active, n, 50.0);
+
+    for (int pe = 0; pe < report.npes; pe++) {
+      if (row[pe] < 0.0) {
+        continue;
+      }
+      double ratio = (median > 0.0) ? row[pe] / median : 1.0;
+      char size_str[32], ratio_str[32];
+      if (rows[i].msg_size != REPORT_NO_SIZE) {
+        snprintf(size_str, sizeof(size_str), "%zu", rows[i].msg_size);
+      } else {
+        snprintf(size_str, sizeof(size_str), "-");
+      }
+      snprintf(ratio_str, sizeof(ratio_str), "%.2fx", ratio);
+      fprintf(out, "%-16s %-8d %-14.2f %-12s%s\n", size_str, pe, row[pe],
+              ratio_str, ratio > STRAGGLER_THRESHOLD ? "<-- straggler" : "");
+    }
+  }
+  fprintf(out, "\n");
+
+  free(active);
+}
+
+/**
+  @brief Print the bandwidth of every pair of --pairs per row
+  @param out Stream to write to
+  @param rows Result rows carrying the pairs
+  @param num_rows Number of rows
+ */
+static void report_text_pair_table(FILE *out, const report_row_t *rows,
+                                   int num_rows) {
+  fprintf(out, "==============================================\n");
+  fprintf(out, "===          Per-Pair Bandwidth            ===\n");
+  fprintf(out, "==============================================\n");
+  fprintf(out, "%-16s %-8s %-16s %-14s\n", "Message Size", "Pair", "PEs",
+          "MB/s");
+
+  for (int i = 0; i < num_rows; i++) {
+    const report_row_t *r = &rows[i];
+    for (int p = 0; p < r->pairs; p++) {
+      char pes_str[32];
+      snprintf(pes_str, sizeof(pes_str), "%d <-> %d", r->pair_pes[2 * p],
+               r->pair_pes[2 * p + 1]);
+      fprintf(out, "%-16zu %-8d %-16s %-14.2f\n", r->msg_size, p, pes_str,
+              r->pair_bw[p]);
+    }
+  }
+  fprintf(out, "\n");
+}
+
+/**
+  @brief Print an op and the alternative it is compared against side by
+  side, then the size at which the faster of the two changes
+  @param out Stream to write to
+  @param info Benchmark the rows belong to, with the compared benchmark
+  @param rows Result rows carrying both timings
+  @param num_rows Number of rows
+ */
+static void report_text_compare_table(FILE *out, const report_info_t *info,
+                                      const report_row_t *rows,
+                                      int num_rows) {
+  /* pack compares a strided op against packing, rma a direct copy through
+     shmem_ptr against shmem_putmem */
+  bool pack = strcmp(info->benchtype, "pack") == 0;
+  const char *own = pack ? "Direct" : "Pointer";
+  const char *alt = pack ? "Packed" : "RMA";
+  char own_us[16], own_bw[16], alt_us[16], alt_bw[16];
+  snprintf(own_us, sizeof(own_us), "%s (us)", own);
+  snprintf(own_bw, sizeof(own_bw), "%s MB/s", own);
+  snprintf(alt_us, sizeof(alt_us), "%s (us)", alt);
+  snprintf(alt_bw, sizeof(alt_bw), "%s MB/s", alt);
+
+  fprintf(out, "  %s: %s\n", own, info->benchmark);
+  fprintf(out, "  %s: %s\n\n", alt, info->compare);
+  /* Only strided rows count elements; byte copies have none to show */
+  fprintf(out, "%-16s ", "Message Size");
+  if (pack) {
+    fprintf(out, "%-10s ", "Elements");
+  }
+  fprintf(out, "%-14s %-14s %-14s %-14s %-14s %-8s\n", own_us, own_bw,
+          alt_us, alt_bw, "Speedup", "Faster");
+
+  for (int i = 0; i < num_rows; i++) {
+    const report_row_t *r = &rows[i];
+    double speedup = (r->compare_us > 0.0) ? r->time_us / r->compare_us : 0.0;
+    fprintf(out, "%-16zu ", r->msg_size);
+    if (pack) {
+      fprintf(out, "%-10zu ", r->elems);
+    }
+    fprintf(out, "%-14.2f %-14.2f %-14.2f %-14.2f %-14.2f %-8s\n",
+            r->time_us, r->bandwidth, r->compare_us, r->compare_bw, speedup,
+            r->compare_us < r->time_us ? alt : own);
+  }
+
+  /* The crossover is the first size whose faster path differs from the
+     smallest size's */
+  int cross = -1;
+  for (int i = 1; i < num_rows && cross < 0; i++) {
+    if ((rows[i].compare_us < rows[i].time_us) !=
+        (rows[0].compare_us < rows[0].time_us)) {
+      cross = i;
+    }
+  }
+  if (num_rows == 0) {
+    fprintf(out, "\n");
+  } else if (cross < 0) {
+    fprintf(out, "\nCrossover: none, %s is faster at every size\n\n",
+            rows[0].compare_us < rows[0].time_us ? info->compare
+                                                 : info->benchmark);
+  } else {
+    fprintf(out, "\nCrossover: %s is faster from %zu bytes",
+            rows[cross].compare_us < rows[cross].time_us ? info->compare
+                                                         : info->benchmark,
+            rows[cross].msg_size);
+    if (pack) {
+      fprintf(out, " (%zu elements)", rows[cross].elems);
+    }
+    fprintf(out, "\n\n");
+  }
+}
+
+/**
+  @brief Print the result table of a message-size sweep
+  @param info Benchmark the rows belong to
+  @param rows Result rows in message-size order
+  @param num_rows Number of rows
+ */
+static void report_text_table(const report_info_t *info,
+                              const report_row_t *rows, int num_rows) {
+  FILE *out = report.out;
+  bool latency = strcmp(info->benchtype, "latency") == 0;
+  bool rate = strcmp(info->benchtype, "mr") == 0;
+  bool overlap = strcmp(info->benchtype, "overlap") == 0;
+  bool align = strcmp(info->benchtype, "align") == 0;
+  bool chase = strcmp(info->benchtype, "chase") == 0;
+  bool updates = strcmp(info->benchtype, "updates") == 0;
+  /* With --pairs the bandwidth and message rate are summed over all pairs */
+  bool pairs = num_rows > 0 && rows[0].pairs > 0;
+  const char *bw_label = pairs ? "Agg MB/s" : "Avg MB/s";
+  const char *rate_label = pairs ? "Agg Messages/s" : "Messages/s";
+
+  fprintf(out, "==============================================\n");
+  fprintf(out, "===          Benchmark Results             ===\n");
+  fprintf(out, "==============================================\n");
+
+  /* Benchmarks run under --ordering print one table per semantic, the
+     lines of any other sweep following */
+  if (num_rows > 0 && rows[0].ordering != NULL) {
+    fprintf(out, "  Ordering: %s\n", rows[0].ordering);
+    if (rows[0].stride == 0 && rows[0].chunks == 0 && !align &&
+        rows[0].src_offset == 0 && rows[0].dst_offset == 0 &&
+        info->compare == NULL) {
+      fprintf(out, "\n");
+    }
+  }
+  /* Strided benchmarks print one table per --stride */
+  if (num_rows > 0 && rows[0].stride > 0) {
+    fprintf(out, "  Stride (elements): %d\n", rows[0].stride);
+    if (info->compare == NULL) {
+      fprintf(out, "\n");
+    }
+  }
+  /* Chunked benchmarks print one table per --chunks */
+  if (num_rows > 0 && rows[0].chunks > 0) {
+    fprintf(out, "  Chunks per transfer: %d\n\n", rows[0].chunks);
+  }
+  /* Traffic benchmarks print one table per --traffic */
+  if (num_rows > 0 && rows[0].traffic != NULL) {
+    fprintf(out, "  Traffic: %s, %.0f%% reads\n\n", rows[0].traffic,
+            rows[0].read_pct);
+  }
+  /* Shifted buffers (--src-offset, --dst-offset or the alignment sweep)
+     print one table per offset */
+  if (num_rows > 0 &&
+      (align || rows[0].src_offset > 0 || rows[0].dst_offset > 0)) {
+    fprintf(out, "  Offset (bytes): source %d, destination %d\n\n",
+            rows[0].src_offset, rows[0].dst_offset);
+  }
+  if (info->compare != NULL) {
+    report_text_compare_table(out, info, rows, num_rows);
+    return;
+  }
+
+  /* Print table headers based on the benchtype; the PE columns summarize
+     the time per operation of every PE that issued operations */
+  if (latency) {
+    fprintf(out, "%-16s %-16s %-12s %-12s %-12s", "Message Size",
+            "Latency (us)", "PE Min (us)", "PE Avg (us)", "PE Max (us)");
+  } else if (chase) {
+    /* Pointer chasing reports nanoseconds per dependent load at each
+       working set per PE */
+    fprintf(out, "%-20s %-12s %-14s %-14s %-14s", "Working Set (bytes)",
+            "Nodes/PE", "Latency (ns)", "PE Min (ns)", "PE Max (ns)");
+  } else if (updates) {
+    /* Every PE issues its own accesses; rates are summed over all PEs */
+    fprintf(out, "%-16s %-16s %-14s %-12s %-12s %-12s", "Message Size",
+            "Agg Updates/s", "Agg MB/s", "PE Min (us)", "PE Avg (us)",
+            "PE Max (us)");
+  } else if (overlap) {
+    fprintf(out, "%-16s %-14s %-12s %-14s %-12s %-12s %-12s %-12s",
+            "Message Size", "Overall (us)", "Pure (us)", "Compute (us)",
+            "Overlap (%)", "PE Min (us)", "PE Avg (us)", "PE Max (us)");
+  } else if (rate) {
+    fprintf(out, "%-16s %-8s %-14s %-16s %-12s %-12s %-12s", "Message Size",
+            "Window", bw_label, rate_label, "PE Min (us)", "PE Avg (us)",
+            "PE Max (us)");
+  } else {
+    fprintf(out, "%-16s %-16s %-14s", "Message Size", "Latency (us)",
+            bw_label);
+    if (pairs) {
+      fprintf(out, " %-16s", rate_label);
+    }
+    if (align) {
+      fprintf(out, " %-12s", "Penalty (%)");
+    }
+    fprintf(out, " %-12s %-12s %-12s", "PE Min (us)", "PE Avg (us)",
+            "PE Max (us)");
+  }
+  /* Adaptive runs also report how many operations each row needed */
+  if (report.adaptive) {
+    fprintf(out, " %-10s %-8s", "Iters", "CI (%)");
+  }
+  fprintf(out, "\n");
+
+  /* Print each row of the table */
+  for (int i = 0; i < num_rows; i++) {
+    const report_row_t *r = &rows[i];
+    if (latency) {
+      fprintf(out, "%-16zu %-16.2f %-12.2f %-12.2f %-12.2f", r->msg_size,
+              r->time_us, r->pe.min, r->pe.avg, r->pe.max);
+    } else if (chase) {
+      fprintf(out, "%-20zu %-12zu %-14.1f %-14.1f %-14.1f", r->msg_size,
+              r->elems, r->time_us * 1e3, r->pe.min * 1e3, r->pe.max * 1e3);
+    } else if (updates) {
+      fprintf(out, "%-16zu %-16.0f %-14.2f %-12.2f %-12.2f %-12.2f",
+              r->msg_size, r->msg_rate, r->bandwidth, r->pe.min, r->pe.avg,
+              r->pe.max);
+    } else if (overlap) {
+      fprintf(out, "%-16zu %-14.2f %-12.2f %-14.2f %-12.1f %-12.2f %-12.2f "
+                   "%-12.2f",
+              r->msg_size, r->time_us, r->pure_us, r->compute_us, r->overlap,
+              r->pe.min, r->pe.avg, r->pe.max);
+    } else if (rate) {
+      fprintf(out, "%-16zu %-8d %-14.2f %-16.0f %-12.2f %-12.2f %-12.2f",
+              r->msg_size, r->window, r->bandwidth, r->msg_rate, r->pe.min,
+              r->pe.avg, r->pe.max);
+    } else {
+      fprintf(out, "%-16zu %-16.2f %-14.2f", r->msg_size, r->time_us,
+              r->bandwidth);
+      if (pairs) {
+        fprintf(out, " %-16.0f", r->msg_rate);
+      }
+      if (align) {
+        fprintf(out, " %-12.1f", r->penalty);
+      }
+      fprintf(out, " %-12.2f %-12.2f %-12.2f", r->pe.min, r->pe.avg,
+              r->pe.max);
+    }
+    if (report.adaptive) {
+      char ci_str[32];
+      if (r->ci >= 0.0) {
+        snprintf(ci_str, sizeof(ci_str), "%.2f", r->ci);
+      } else {
+        snprintf(ci_str, sizeof(ci_str), "-");
+      }
+      fprintf(out, " %-10ld %-8s", r->iters, ci_str);
+    }
+    fprintf(out, "\n");
+  }
+
+  fprintf(out, "\n");
+
+  if (pairs) {
+    report_text_pair_table(out, rows, num_rows);
+  }
+
+  if (num_rows > 0 && rows[0].pe_times != NULL) {
+    report_text_pe_table(out, rows, num_rows);
+  }
+
+  /* Per-operation latency distribution when sampling was enabled */
+  if (num_rows > 0 && rows[0].stats != NULL) {
+    fprintf(out, "==============================================\n");
+    fprintf(out, "===      Latency Distribution (us)         ===\n");
+    fprintf(out, "==============================================\n");
+    fprintf(out, "%-16s %-10s %-10s %-10s %-10s %-10s %-10s %-10s\n",
+            "Message Size", "Min", "P50", "P90", "P99", "P99.9", "Max",
+            "Stddev");
+    for (int i = 0; i < num_rows; i++) {
+      const sample_stats_t *st = rows[i].stats;
+      fprintf(out,
+              "%-16zu %-10.2f %-10.2f %-10.2f %-10.2f %-10.2f %-10.2f "
+              "%-10.2f\n",
+              rows[i].msg_size, st->min, st->p50, st->p90, st->p99, st->p999,
+              st->max, st->stddev);
+    }
+    fprintf(out,
+            "Note: sampling completes and timestamps every operation on its "
+            "own,\nso the averages above include one completion and one "
+            "timer read\nper operation.\n");
+    fprintf(out, "\n");
+  }
+}
+
+/**
+  @brief Print the result of a size-less benchmark (atomics, barrier)
+  @param info Benchmark the row belongs to
+  @param r The single result row
+ */
+static void report_text_single(const report_info_t *info,
+                               const report_row_t *r) {
+  FILE *out = report.out;
+  char label[64];
+
+  bool mr = strcmp(info->benchtype, "mr") == 0;
+  bool updates = strcmp(info->benchtype, "updates") == 0;
+  snprintf(label, sizeof(label), "%s %s", info->benchmark,
+           r->overlap >= 0.0 ? "Overlap"
+           : mr              ? "Message Rate"
+           : updates         ? "Updates"
+                             : "Latency");
+  fprintf(out, "==============================================\n");
+  fprintf(out, "=== %-38s ===\n", label);
+  fprintf(out, "==============================================\n");
+
+  snprintf(label, sizeof(label), "Avg Time per %s (us):", info->op_name);
+  fprintf(out, "%-30s %.2f\n", label, r->time_us);
+  snprintf(label, sizeof(label), "Total Time for %ld %ss (us):", r->iters,
+           info->op_name);
+  fprintf(out, "%-30s %.2f\n", label, r->time_us * r->iters);
+  if (r->overlap >= 0.0) {
+    fprintf(out, "%-30s %.2f\n", "Pure Time (us):", r->pure_us);
+    fprintf(out, "%-30s %.2f\n", "Compute Time (us):", r->compute_us);
+    fprintf(out, "%-30s %.1f\n", "Overlap (%):", r->overlap);
+  }
+  if (report.adaptive && r->ci >= 0.0) {
+    fprintf(out, "%-30s %.2f\n", "95% CI of Mean (%):", r->ci);
+  }
+  fprintf(out, "%-30s %.2f\n", "PE Min Time (us):", r->pe.min);
+  fprintf(out, "%-30s %.2f\n", "PE Avg Time (us):", r->pe.avg);
+  fprintf(out, "%-30s %.2f (PE %d)\n", "PE Max Time (us):", r->pe.max,
+          r->pe.slowest_pe);
+  if (r->traffic != NULL) {
+    fprintf(out, "%-30s %s\n", "Traffic:", r->traffic);
+    fprintf(out, "%-30s %.0f\n", "Reads (%):", r->read_pct);
+    fprintf(out, "%-30s %.0f\n", "Aggregate Updates/s:", r->msg_rate);
+  }
+  if (mr) {
+    fprintf(out, "%-30s %.0f\n", "Rate per PE (ops/s):", r->msg_rate);
+    fprintf(out, "%-30s %.0f\n", "Aggregate Rate (ops/s):",
+            r->msg_rate * r->pe.active);
+  }
+
+  /* Single-element ops are timed next to the equivalent transfer routine */
+  if (info->compare != NULL) {
+    fprintf(out, "%-30s %s\n", "Compared With:", info->compare);
+    snprintf(label, sizeof(label), "Avg Time per %s (us):", info->op_name);
+    fprintf(out, "  %-28s %.2f\n", label, r->compare_us);
+    if (mr) {
+      fprintf(out, "  %-28s %.0f\n", "Rate per PE (ops/s):",
+              r->compare_us > 0.0 ? 1e6 / r->compare_us : 0.0);
+    }
+    fprintf(out, "%-30s %.2fx\n", "Speedup:",
+            r->time_us > 0.0 ? r->compare_us / r->time_us : 0.0);
+  }
+
+  if (r->pe_times != NULL) {
+    fprintf(out, "\n");
+    report_text_pe_table(out, r, 1);
+  }
+
+  if (r->stats != NULL) {
+    const sample_stats_t *st = r->stats;
+    fprintf(out, "%-30s %d\n", "Samples:", st->count);
+    fprintf(out, "%-30s %.2f\n", "Min Time (us):", st->min);
+    fprintf(out, "%-30s %.2f\n", "P50 Time (us):", st->p50);
+    fprintf(out, "%-30s %.2f\n", "P90 Time (us):", st->p90);
+    fprintf(out, "%-30s %.2f\n", "P99 Time (us):", st->p99);
+    fprintf(out, "%-30s %.2f\n", "P99.9 Time (us):", st->p999);
+    fprintf(out, "%-30s %.2f\n", "Max Time (us):", st->max);
+    fprintf(out, "%-30s %.2f\n", "Stddev (us):", st->stddev);
+  }
+  fprintf(out, "==============================================\n\n");
+}
+
+/**
+  @brief Write a JSON string literal with the required escapes
+  @param out Stream to write to
+  @param s String to write
+ */
+static void json_string(FILE *out, const char *s) {
+  fputc('"', out);
+  for (; *s != '\0'; s++) {
+    unsigned char c = (unsigned char)*s;
+    if (c == '"' || c == '\\') {
+      fprintf(out, "\\%c", c);
+    } else if (c < 0x20) {
+      fprintf(out, "\\u%04x", c);
+    } else {
+      fputc(c, out);
+    }
+  }
+  fputc('"', out);
+}
+
+/**
+  @brief Write a JSON number, or null if the value is missing
+  @param out Stream to write to
+  @param value Value to write
+  @param present False to write null instead
+ */
+static void json_number(FILE *out, double value, bool present) {
+  if (present && isfinite(value)) {
+    fprintf(out, "%.6g", value);
+  } else {
+    fprintf(out, "null");
+  }
+}
+
+/**
+  @brief Write a byte or element count as an exact JSON integer, or null
+  if it is missing (json_number would round sizes past a million)
+  @param out Stream to write to
+  @param value Value to write
+  @param present False to write null instead
+ */
+static void json_size(FILE *out, size_t value, bool present) {
+  if (present) {
+    fprintf(out, "%zu", value);
+  } else {
+    fprintf(out, "null");
+  }
+}
+
+/**
+  @brief Write one result row as a JSON Lines record
+  @param info Benchmark the row belongs to
+  @param r Result row
+ */
+static void report_json_row(const report_info_t *info, const report_row_t *r) {
+  FILE *out = report.out;
+  const options *o = report.opts;
+
+  fprintf(out, "{\"benchmark\":");
+  json_string(out, info->benchmark);
+  fprintf(out, ",\"benchtype\":");
+  json_string(out, info->benchtype);
+  fprintf(out, ",\"type\":");
+  if (info->type != NULL) {
+    json_string(out, info->type);
+  } else {
+    fprintf(out, "null");
+  }
+  fprintf(out, ",\"npes\":%d,\"msg_size\":", report.npes);
+  json_size(out, r->msg_size, r->msg_size != REPORT_NO_SIZE);
+  fprintf(out, ",\"window\":");
+  json_number(out, r->window, r->window > 0);
+  fprintf(out, ",\"chunks\":");
+  json_number(out, r->chunks, r->chunks > 0);
+  fprintf(out, ",\"ordering\":");
+  if (r->ordering != NULL) {
+    json_string(out, r->ordering);
+  } else {
+    fprintf(out, "null");
+  }
+  fprintf(out, ",\"traffic\":");
+  if (r->traffic != NULL) {
+    json_string(out, r->traffic);
+  } else {
+    fprintf(out, "null");
+  }
+  fprintf(out, ",\"read_pct\":");
+  json_number(out, r->read_pct, r->read_pct >= 0.0);
+  fprintf(out, ",\"stride\":");
+  json_number(out, r->stride, r->stride > 0);
+  fprintf(out, ",\"elements\":");
+  json_size(out, r->elems, r->stride > 0);
+  fprintf(out, ",\"src_offset\":%d,\"dst_offset\":%d", r->src_offset,
+          r->dst_offset);
+  fprintf(out, ",\"pairs\":");
+  json_number(out, r->pairs, r->pairs > 0);
+  fprintf(out, ",\"iterations\":%ld,\"time_us\":", r->iters);
+  json_number(out, r->time_us, true);
+  fprintf(out, ",\"pe_min_us\":");
+  json_number(out, r->pe.min, true);
+  fprintf(out, ",\"pe_avg_us\":");
+  json_number(out, r->pe.avg, true);
+  fprintf(out, ",\"pe_max_us\":");
+  json_number(out, r->pe.max, true);
+  fprintf(out, ",\"slowest_pe\":%d,\"active_pes\":%d,\"ci_pct\":",
+          r->pe.slowest_pe, r->pe.active);
+  json_number(out, r->ci, r->ci >= 0.0);
+  fprintf(out, ",\"bandwidth_mbs\":");
+  json_number(out, r->bandwidth, r->bandwidth >= 0.0);
+  fprintf(out, ",\"msg_rate\":");
+  json_number(out, r->msg_rate, true);
+  fprintf(out, ",\"pure_us\":");
+  json_number(out, r->pure_us, r->overlap >= 0.0);
+  fprintf(out, ",\"compute_us\":");
+  json_number(out, r->compute_us, r->overlap >= 0.0);
+  fprintf(out, ",\"overlap_pct\":");
+  json_number(out, r->overlap, r->overlap >= 0.0);
+  fprintf(out, ",\"penalty_pct\":");
+  json_number(out, r->penalty, strcmp(info->benchtype, "align") == 0);
+
+  if (info->compare != NULL) {
+    fprintf(out, ",\"compare\":{\"benchmark\":");
+    json_string(out, info->compare);
+    fprintf(out, ",\"time_us\":");
+    json_number(out, r->compare_us, true);
+    fprintf(out, ",\"bandwidth_mbs\":");
+    json_number(out, r->compare_bw, true);
+    fprintf(out, "}");
+  }
+
+  if (r->stats != NULL) {
+    const sample_stats_t *st = r->stats;
+    fprintf(out, ",\"latency_us\":{\"samples\":%d,\"min\":", st->count);
+    json_number(out, st->min, true);
+    fprintf(out, ",\"p50\":");
+    json_number(out, st->p50, true);
+    fprintf(out, ",\"p90\":");
+    json_number(out, st->p90, true);
+    fprintf(out, ",\"p99\":");
+    json_number(out, st->p99, true);
+    fprintf(out, ",\"p999\":");
+    json_number(out, st->p999, true);
+    fprintf(out, ",\"max\":");
+    json_number(out, st->max, true);
+    fprintf(out, ",\"stddev\":");
+    json_number(out, st->stddev, true);
+    fprintf(out, "}");
+  }
+
+  if (r->pairs > 0) {
+    fprintf(out, ",\"per_pair\":[");
+    for (int p = 0; p < r->pairs; p++) {
+      fprintf(out, "%s{\"initiator\":%d,\"partner\":%d,\"bandwidth_mbs\":",
+              p > 0 ? "," : "", r->pair_pes[2 * p], r->pair_pes[2 * p + 1]);
+      json_number(out, r->pair_bw[p], true);
+      fprintf(out, "}");
+    }
+    fprintf(out, "]");
+  }
+
+  if (r->pe_times != NULL) {
+    fprintf(out, ",\"pe_times_us\":[");
+    for (int pe = 0; pe < report.npes; pe++) {
+      fprintf(out, pe > 0 ? "," : "");
+      json_number(out, r->pe_times[pe], r->pe_times[pe] >= 0.0);
+    }
+    fprintf(out, "]");
+  }
+
+  fprintf(out, ",\"library\":{\"name\":");
+  json_string(out, report.lib_name);
+  fprintf(out, ",\"version\":");
+  json_string(out, report.lib_version);
+  fprintf(out, "},\"config\":{\"ntimes\":%d,\"stride\":%d,\"sizes\":",
+          report.ntimes, report.stride);
+  json_string(out, report.sizes);
+  fprintf(out, ",\"warmup\":");
+  if (o->warmup_auto) {
+    json_string(out, "auto");
+  } else {
+    fprintf(out, "%d", o->warmup);
+  }
+  fprintf(out, ",\"timer\":");
+  json_string(out, timer_backend_name(timer_info.backend));
+  fprintf(out, ",\"timer_overhead_ns\":");
+  json_number(out, timer_info.overhead_ns, true);
+  fprintf(out, ",\"timer_resolution_ns\":");
+  json_number(out, timer_info.resolution_ns, true);
+  fprintf(out,
+          ",\"subtract_overhead\":%s,\"percentiles\":%s,\"pe_table\":%s,"
+          "\"target_ci\":",
+          o->subtract_overhead ? "true" : "false",
+          o->percentiles ? "true" : "false", o->pe_table ? "true" : "false");
+  json_number(out, o->target_ci, o->target_ci > 0.0);
+  fprintf(out, ",\"max_time\":");
+  json_number(out, o->max_time, o->max_time > 0.0);
+  fprintf(out, ",\"buffers\":");
+  json_string(out, o->realloc_per_size ? "realloc" : "pooled");
+  fprintf(out, ",\"pairing\":");
+  json_string(out, pair_policy_name(o->pairs));
+  fprintf(out, ",\"cache\":");
+  json_string(out, o->cache_cold ? "cold" : "warm");
+  fprintf(out, ",\"cache_ring\":%ld}}\n", o->cache_cold ? o->cache_ring : 0L);
+}
+
+/**
+  @brief Write a CSV field, quoting it if it contains separators or quotes
+  @param out Stream to write to
+  @param s Field value
+ */
+static void csv_string(FILE *out, const char *s) {
+  if (strpbrk(s, ",\"\n") == NULL) {
+    fputs(s, out);
+    return;
+  }
+  fputc('"', out);
+  for (; *s != '\0'; s++) {
+    if (*s == '"') {
+      fputc('"', out);
+    }
+    fputc(*s, out);
+  }
+  fputc('"', out);
+}
+
+/**
+  @brief Write a CSV number, or an empty field if the value is missing
+  @param out Stream to write to
+  @param value Value to write
+  @param present False to leave the field empty
+ */
+static void csv_number(FILE *out, double value, bool present) {
+  if (present && isfinite(value)) {
+    fprintf(out, "%.6g", value);
+  }
+}
+
+/**
+  @brief Write a byte or element count as an exact CSV integer, or an
+  empty field if it is missing
+  @param out Stream to write to
+  @param value Value to write
+  @param present False to leave the field empty
+ */
+static void csv_size(FILE *out, size_t value, bool present) {
+  if (present) {
+    fprintf(out, "%zu", value);
+  }
+}
+
+/**
+  @brief Write one result row as a CSV line, preceded by the header line
+  the first time
+  @param info Benchmark the row belongs to
+  @param r Result row
+ */
+static void report_csv_row(const report_info_t *info, const report_row_t *r) {
+  FILE *out = report.out;
+  const options *o = report.opts;
+
+  if (!report.csv_header) {
+    fprintf(out, "benchmark,benchtype,type,npes,msg_size,window,chunks,"
+                 "ordering,traffic,read_pct,row_stride,elements,src_offset,"
+                 "dst_offset,pairs,"
+                 "iterations,time_us,pe_min_us,pe_avg_us,pe_max_us,slowest_pe,"
+                 "active_pes,ci_pct,bandwidth_mbs,msg_rate,pure_us,compute_us,"
+                 "overlap_pct,penalty_pct,compare_benchmark,"
+                 "compare_time_us,compare_bandwidth_mbs,samples,min_us,"
+                 "p50_us,p90_us,p99_us,p999_us,max_us,stddev_us,library,"
+                 "library_version,ntimes,stride,sizes,warmup,timer,"
+                 "timer_overhead_ns,timer_resolution_ns,subtract_overhead,"
+                 "target_ci,max_time,buffers,pairing,cache,cache_ring\n");
+    report.csv_header = true;
+  }
+
+  csv_string(out, info->benchmark);
+  fputc(',', out);
+  csv_string(out, info->benchtype);
+  fputc(',', out);
+  csv_string(out, info->type != NULL ? info->type : "");
+  fprintf(out, ",%d,", report.npes);
+  csv_size(out, r->msg_size, r->msg_size != REPORT_NO_SIZE);
+  fputc(',', out);
+  csv_number(out, r->window, r->window > 0);
+  fputc(',', out);
+  csv_number(out, r->chunks, r->chunks > 0);
+  fputc(',', out);
+  csv_string(out, r->ordering != NULL ? r->ordering : "");
+  fputc(',', out);
+  csv_string(out, r->traffic != NULL ? r->traffic : "");
+  fputc(',', out);
+  csv_number(out, r->read_pct, r->read_pct >= 0.0);
+  fputc(',', out);
+  csv_number(out, r->stride, r->stride > 0);
+  fputc(',', out);
+  csv_size(out, r->elems, r->stride > 0);
+  fprintf(out, ",%d,%d,", r->src_offset, r->dst_offset);
+  csv_number(out, r->pairs, r->pairs > 0);
+  fprintf(out, ",%ld,", r->iters);
+  csv_number(out, r->time_us, true);
+  fputc(',', out);
+  csv_number(out, r->pe.min, true);
+  fputc(',', out);
+  csv_number(out, r->pe.avg, true);
+  fputc(',', out);
+  csv_number(out, r->pe.max, true);
+  fprintf(out, ",%d,%d,", r->pe.slowest_pe, r->pe.active);
+  csv_number(out, r->ci, r->ci >= 0.0);
+  fputc(',', out);
+  csv_number(out, r->bandwidth, r->bandwidth >= 0.0);
+  fputc(',', out);
+  csv_number(out, r->msg_rate, true);
+  fputc(',', out);
+  csv_number(out, r->pure_us, r->overlap >= 0.0);
+  fputc(',', out);
+  csv_number(out, r->compute_us, r->overlap >= 0.0);
+  fputc(',', out);
+  csv_number(out, r->overlap, r->overlap >= 0.0);
+  fputc(',', out);
+  csv_number(out, r->penalty, strcmp(info->benchtype, "align") == 0);
+  fputc(',', out);
+  csv_string(out, info->compare != NULL ? info->compare : "");
+  fputc(',', out);
+  csv_number(out, r->compare_us, info->compare != NULL);
+  fputc(',', out);
+  csv_number(out, r->compare_bw, info->compare != NULL);
+
+  const sample_stats_t *st = r->stats;
+  if (st != NULL) {
+    fprintf(out, ",%d", st->count);
+  } else {
+    fputc(',', out);
+  }
+  double dist[] = {st ? st->min : 0.0, st ? st->p50 : 0.0, st ? st->p90 : 0.0,
+                   st ? st->p99 : 0.0, st ? st->p999 : 0.0,
+                   st ? st->max : 0.0, st ? st->stddev : 0.0};
+  for (int i = 0; i < (int)(sizeof(dist) / sizeof(dist[0])); i++) {
+    fputc(',', out);
+    csv_number(out, dist[i], st != NULL);
+  }
+
+  fputc(',', out);
+  csv_string(out, report.lib_name);
+  fputc(',', out);
+  csv_string(out, report.lib_version);
+  fprintf(out, ",%d,%d,", report.ntimes, report.stride);
+  csv_string(out, report.sizes);
+  if (o->warmup_auto) {
+    fprintf(out, ",auto,");
+  } else {
+    fprintf(out, ",%d,", o->warmup);
+  }
+  csv_string(out, timer_backend_name(timer_info.backend));
+  fputc(',', out);
+  csv_number(out, timer_info.overhead_ns, true);
+  fputc(',', out);
+  csv_number(out, timer_info.resolution_ns, true);
+  fprintf(out, ",%d,", o->subtract_overhead ? 1 : 0);
+  csv_number(out, o->target_ci, o->target_ci > 0.0);
+  fputc(',', out);
+  csv_number(out, o->max_time, o->max_time > 0.0);
+  fprintf(out, ",%s,%s,%s,%ld\n", o->realloc_per_size ? "realloc" : "pooled",
+          pair_policy_name(o->pairs), o->cache_cold ? "cold" : "warm",
+          o->cache_cold ? o->cache_ring : 0L);
+}
+
+/**
+  @brief Emit the results of one benchmark in the selected format
+  @param info Benchmark the rows belong to
+  @param rows Result rows in message-size order
+  @param num_rows Number of rows
+ */
+void report_emit(const report_info_t *info, const report_row_t *rows,
+                 int num_rows) {
+  if (report.out == NULL) {
+    report.out = stdout;
+  }
+
+  switch (report.format) {
+  case OUTPUT_JSON:
+    for (int i = 0; i < num_rows; i++) {
+      report_json_row(info, &rows[i]);
+    }
+    break;
+  case OUTPUT_CSV:
+    for (int i = 0; i < num_rows; i++) {
+      report_csv_row(info, &rows[i]);
+    }
+    break;
+  default:
+    if (info->op_name != NULL && num_rows > 0) {
+      report_text_single(info, &rows[0]);
+    } else {
+      report_text_table(info, rows, num_rows);
+    }
+    break;
+  }
+  fflush(report.out);
+}
+
+/**
+  @brief Emit the comparison of the typed variants of one benchmark (text
+  output only; the JSON and CSV rows of every variant carry its type)
+  @param info Benchmark the variants belong to
+  @param rows Summary of every variant in run order
+  @param num_rows Number of variants
+ */
+void report_emit_types(const report_info_t *info,
+                       const report_type_row_t *rows, int num_rows) {
+  if (report.format != OUTPUT_TEXT || num_rows == 0) {
+    return;
+  }
+  FILE *out = (report.out != NULL) ? report.out : stdout;
+
+  /* Peaks are relative to the long variant, the benchmark's default */
+  double base = 0.0;
+  for (int i = 0; i < num_rows; i++) {
+    if (rows[i].type != NULL && strcmp(rows[i].type, "long") == 0) {
+      base = rows[i].peak_bw;
+    }
+  }
+
+  fprintf(out, "==============================================\n");
+  fprintf(out, "===          Type Comparison               ===\n");
+  fprintf(out, "==============================================\n");
+  fprintf(out, "  Benchmark: %s (%s)\n", info->benchmark, info->benchtype);
+  if (rows[0].stride > 0) {
+    fprintf(out, "  Stride (elements): %d\n", rows[0].stride);
+  }
+  fprintf(out, "\n");
+  fprintf(out, "%-12s %-24s %-6s %-10s %-14s %-12s %-14s %-8s\n", "Type",
+          "Routine", "Bytes", "Min Size", "Min Size (us)", "Peak Size",
+          "Peak MB/s", "vs long");
+
+  for (int i = 0; i < num_rows; i++) {
+    const report_type_row_t *t = &rows[i];
+    char rel[32];
+    if (base > 0.0) {
+      snprintf(rel, sizeof(rel), "%.1f%%", 100.0 * t->peak_bw / base);
+    } else {
+      snprintf(rel, sizeof(rel), "-");
+    }
+    fprintf(out, "%-12s %-24s %-6d %-10zu %-14.2f %-12zu %-14.2f %-8s\n",
+            t->type, t->benchmark, t->elem_size, t->min_size, t->min_us,
+            t->peak_size, t->peak_bw, rel);
+  }
+  fprintf(out, "\n");
+  fflush(out);
+}
+
+/**
+  @brief Emit the bandwidth penalty of every offset of an alignment sweep
+  at every message size (text output only; the JSON and CSV rows of every
+  sweep carry their penalty)
+  @param info Benchmark the sweeps belong to
+  @param msg_sizes Message size of each row
+  @param num_sizes Number of rows
+  @param offsets Offset of each sweep in bytes
+  @param num_offsets Number of sweeps
+  @param penalty Penalty in percent, num_sizes per offset
+ */
+void report_emit_align(const report_info_t *info, const size_t *msg_sizes,
+                       int num_sizes, const int *offsets, int num_offsets,
+                       const double *penalty) {
+  if (report.format != OUTPUT_TEXT || num_sizes == 0) {
+    return;
+  }
+  FILE *out = (report.out != NULL) ? report.out : stdout;
+
+  fprintf(out, "==============================================\n");
+  fprintf(out, "===      Alignment Penalty (%%)             ===\n");
+  fprintf(out, "==============================================\n");
+  fprintf(out, "  Benchmark: %s (%s)\n", info->benchmark, info->benchtype);
+  fprintf(out, "  Bandwidth lost against offset 0, by offset in bytes\n\n");
+
+  fprintf(out, "%-16s", "Message Size");
+  for (int k = 0; k < num_offsets; k++) {
+    fprintf(out, " %-8d", offsets[k]);
+  }
+  fprintf(out, "\n");
+  for (int i = 0; i < num_sizes; i++) {
+    fprintf(out, "%-16zu", msg_sizes[i]);
+    for (int k = 0; k < num_offsets; k++) {
+      fprintf(out, " %-8.1f", penalty[k * num_sizes + i]);
+    }
+    fprintf(out, "\n");
+  }
+  fprintf(out, "\n");
+  fflush(out);
+}
+
+/**
+  @brief Emit the time per operation of every --ordering semantic at every
+  message size, with what each costs against the first (text output only;
+  the JSON and CSV rows of every sweep carry their semantic)
+  @param info Benchmark the sweeps belong to
+  @param msg_sizes Message size of each row
+  @param num_sizes Number of rows
+  @param orderings Name of each sweep's semantic
+  @param num_orderings Number of sweeps
+  @param time_us Time per operation in microseconds, num_sizes per sweep
+ */
+void report_emit_ordering(const report_info_t *info, const size_t *msg_sizes,
+                          int num_sizes, const char *const *orderings,
+                          int num_orderings, const double *time_us) {
+  if (report.format != OUTPUT_TEXT || num_sizes == 0) {
+    return;
+  }
+  FILE *out = (report.out != NULL) ? report.out : stdout;
+
+  fprintf(out, "==============================================\n");
+  fprintf(out, "===      Ordering Cost (us)                ===\n");
+  fprintf(out, "==============================================\n");
+  fprintf(out, "  Benchmark: %s (%s)\n", info->benchmark, info->benchtype);
+  fprintf(out, "  Time per operation, and the extra time against %s\n\n",
+          orderings[0]);
+
+  fprintf(out, "%-16s", "Message Size");
+  for (int k = 0; k < num_orderings; k++) {
+    fprintf(out, " %-22s", orderings[k]);
+  }
+  fprintf(out, "\n");
+  for (int i = 0; i < num_sizes; i++) {
+    fprintf(out, "%-16zu", msg_sizes[i]);
+    double base = time_us[i];
+    for (int k = 0; k < num_orderings; k++) {
+      char cell[64];
+      double t = time_us[k * num_sizes + i];
+      if (k == 0) {
+        snprintf(cell, sizeof(cell), "%.2f", t);
+      } else {
+        snprintf(cell, sizeof(cell), "%.2f (%+.2f)", t, t - base);
+      }
+      fprintf(out, " %-22s", cell);
+    }
+    fprintf(out, "\n");
+  }
+  fprintf(out, "\n");
+  fflush(out);
+}
@@ -5,123 +5,1108 @@
 
 #include "shmembench.h"
 
-/* Function pointer type for benchmarks without stride */
-typedef void (*benchmark_func_t)(int min_msg_size, int max_msg_size,
-                                 int ntimes);
+/* Dispatch table for benchmarks: one op descriptor per benchmark and
+   benchtype, run by bench_engine_run */
+static const bench_op_t *const benchmark_table[] = {
+    &bench_shmem_put_bw,
+    &bench_shmem_put_bibw,
+    &bench_shmem_put_latency,
+    &bench_shmem_get_bw,
+    &bench_shmem_get_bibw,
+    &bench_shmem_putmem_bw,
+    &bench_shmem_putmem_bibw,
+    &bench_shmem_putmem_latency,
+    &bench_shmem_putmem_align,
+    &bench_shmem_getmem_bw,
+    &bench_shmem_getmem_bibw,
+    &bench_shmem_getmem_align,
+    &bench_shmem_iput_bw,
+    &bench_shmem_iput_bibw,
+    &bench_shmem_iput_pack,
+    &bench_shmem_iget_bw,
+    &bench_shmem_iget_bibw,
+    &bench_shmem_iget_pack,
+    &bench_shmem_putmem_packed_bw,
+    &bench_shmem_putmem_packed_bibw,
+    &bench_shmem_getmem_unpacked_bw,
+    &bench_shmem_getmem_unpacked_bibw,
+    &bench_shmem_ptr_memcpy_bw,
+    &bench_shmem_ptr_memcpy_bibw,
+    &bench_shmem_ptr_memcpy_rma,
+    &bench_shmem_ptr_stream_bw,
+    &bench_shmem_ptr_stream_bibw,
+    &bench_shmem_ptr_stream_rma,
+    &bench_shmem_ptr_scalar_bw,
+    &bench_shmem_ptr_scalar_bibw,
+    &bench_shmem_ptr_scalar_rma,
+    &bench_shmem_put_nbi_bw,
+    &bench_shmem_put_nbi_bibw,
+    &bench_shmem_put_nbi_mr,
+    &bench_shmem_put_nbi_overlap,
+    &bench_shmem_get_nbi_bw,
+    &bench_shmem_get_nbi_bibw,
+    &bench_shmem_get_nbi_mr,
+    &bench_shmem_get_nbi_overlap,
+    &bench_shmem_putmem_nbi_bw,
+    &bench_shmem_putmem_nbi_bibw,
+    &bench_shmem_putmem_nbi_mr,
+    &bench_shmem_putmem_nbi_align,
+    &bench_shmem_getmem_nbi_bw,
+    &bench_shmem_getmem_nbi_bibw,
+    &bench_shmem_getmem_nbi_mr,
+    &bench_shmem_getmem_nbi_align,
+    &bench_shmem_putmem_chunked_bw,
+    &bench_shmem_putmem_chunked_bibw,
+    &bench_shmem_getmem_chunked_bw,
+    &bench_shmem_getmem_chunked_bibw,
+    &bench_shmem_p_latency,
+    &bench_shmem_p_mr,
+    &bench_shmem_g_latency,
+    &bench_shmem_g_mr,
+    &bench_shmem_g_chase,
+    &bench_shmem_getmem_chase,
+    &bench_shmem_traffic_updates,
+    &bench_shmem_traffic_pg_updates,
+    &bench_shmem_put_signal_bw,
+    &bench_shmem_put_signal_bibw,
+    &bench_shmem_put_signal_latency,
+    &bench_shmem_put_signal_mr,
+    &bench_shmem_put_signal_nbi_bw,
+    &bench_shmem_put_signal_nbi_bibw,
+    &bench_shmem_put_signal_nbi_latency,
+    &bench_shmem_put_signal_nbi_mr,
+    &bench_shmem_put_signal_nbi_overlap,
+    &bench_shmem_put_fence_set_bw,
+    &bench_shmem_put_fence_set_bibw,
+    &bench_shmem_put_fence_set_latency,
+    &bench_shmem_put_fence_set_mr,
+    &bench_shmem_signal_fetch_latency,
+    &bench_shmem_alltoall_bw,
+    &bench_shmem_alltoallmem_bw,
+    &bench_shmem_alltoalls_bw,
+    &bench_shmem_alltoallsmem_bw,
+    &bench_shmem_broadcast_bw,
+    &bench_shmem_broadcastmem_bw,
+    &bench_shmem_collect_bw,
+    &bench_shmem_collectmem_bw,
+    &bench_shmem_fcollect_bw,
+    &bench_shmem_fcollectmem_bw,
+    &bench_shmem_barrier_all_latency,
+    &bench_shmem_atomic_add_latency,
+    &bench_shmem_atomic_compare_swap_latency,
+    &bench_shmem_atomic_fetch_nbi_latency,
+    &bench_shmem_atomic_fetch_nbi_overlap,
+    &bench_shmem_atomic_fetch_latency,
+    &bench_shmem_atomic_inc_latency,
+    &bench_shmem_atomic_set_latency,
+    &bench_shmem_atomic_swap_latency};
 
-/* Function pointer type for benchmarks with stride */
-typedef void (*benchmark_func_with_stride_t)(int min_msg_size, int max_msg_size,
-                                             int ntimes, int stride);
+#define BENCHMARK_TABLE_SIZE                                                   \
+  (int)(sizeof(benchmark_table) / sizeof(benchmark_table[0]))
 
-/* Function pointer type for benchmarks without message size parameters (like
- * barriers and atomics) */
-typedef void (*benchmark_func_no_size_t)(int ntimes);
+/* Message sizes every sweep iterates, built once from the size options */
+size_schedule_t bench_sizes;
 
-/* Mapping of benchmarks and their types to functions */
-typedef struct {
-  const char *benchmark;
-  const char *benchtype;
-  benchmark_func_t func;
-  benchmark_func_with_stride_t func_with_stride;
-  benchmark_func_no_size_t func_no_size;
-  bool uses_stride;
-} benchmark_entry_t;
+/* Windows the message-rate benchmarks sweep, copied from --window */
+int bench_windows[MAX_WINDOWS];
+int bench_num_windows = 0;
 
-/* Dispatch table for benchmarks */
-benchmark_entry_t benchmark_table[] = {
-    {"shmem_put", "bw", bench_shmem_put_bw, NULL, NULL, false},
-    {"shmem_put", "bibw", bench_shmem_put_bibw, NULL, NULL, false},
+/* Chunkings the chunked transfer benchmarks sweep, copied from --chunks */
+int bench_chunks[MAX_CHUNKS];
+int bench_num_chunks = 0;
 
-    {"shmem_get", "bw", bench_shmem_get_bw, NULL, NULL, false},
-    {"shmem_get", "bibw", bench_shmem_get_bibw, NULL, NULL, false},
+/* Ordering semantics the point-to-point RMA benchmarks sweep, copied from
+   --ordering */
+ordering_t bench_orderings[MAX_ORDERINGS];
+int bench_num_orderings = 0;
 
-    {"shmem_putmem", "bw", bench_shmem_putmem_bw, NULL, NULL, false},
-    {"shmem_putmem", "bibw", bench_shmem_putmem_bibw, NULL, NULL, false},
+/* Distributions the traffic benchmarks sweep, copied from --traffic, and
+   their read:write ratio and Zipf exponent (see --rw-ratio and --zipf) */
+traffic_t bench_traffic[MAX_TRAFFIC];
+int bench_num_traffic = 0;
+int bench_traffic_reads = 1;
+int bench_traffic_writes = 1;
+double bench_zipf = DEFAULT_ZIPF;
 
-    {"shmem_getmem", "bw", bench_shmem_getmem_bw, NULL, NULL, false},
-    {"shmem_getmem", "bibw", bench_shmem_getmem_bibw, NULL, NULL, false},
+/* Strides the strided benchmarks sweep, copied from --stride */
+int bench_strides[MAX_STRIDES];
+int bench_num_strides = 0;
 
-    {"shmem_iput", "bw", NULL, bench_shmem_iput_bw, NULL, true},
-    {"shmem_iput", "bibw", NULL, bench_shmem_iput_bibw, NULL, true},
+/* Offsets of the contiguous byte benchmarks, copied from --src-offset and
+   --dst-offset */
+int bench_src_offset = 0;
+int bench_dst_offset = 0;
 
-    {"shmem_iget", "bw", NULL, bench_shmem_iget_bw, NULL, true},
-    {"shmem_iget", "bibw", NULL, bench_shmem_iget_bibw, NULL, true},
+/* Bytes the buffer copies of cold runs rotate through (see --cache), or
+   0 for warm runs */
+size_t bench_cache_ring = 0;
 
-    {"shmem_put_nbi", "bw", bench_shmem_put_nbi_bw, NULL, NULL, false},
-    {"shmem_put_nbi", "bibw", bench_shmem_put_nbi_bibw, NULL, NULL, false},
+/* Op of the benchmark currently running, named in its results */
+static const bench_op_t *bench_current = NULL;
 
-    {"shmem_get_nbi", "bw", bench_shmem_get_nbi_bw, NULL, NULL, false},
-    {"shmem_get_nbi", "bibw", bench_shmem_get_nbi_bibw, NULL, NULL, false},
+/* Summary of every typed variant of the benchmark compared by type, and
+   the row of the running variant (-1 if none) */
+static report_type_row_t *bench_type_rows = NULL;
+static int bench_type_row = -1;
 
-    {"shmem_putmem_nbi", "bw", bench_shmem_putmem_nbi_bw, NULL, NULL, false},
-    {"shmem_putmem_nbi", "bibw", bench_shmem_putmem_nbi_bibw, NULL, NULL, false},
+/* Per-operation sampling state shared with the benchmark kernels */
+bool bench_sampling = false;
+sample_buffer_t bench_samples;
 
-    {"shmem_getmem_nbi", "bw", bench_shmem_getmem_nbi_bw, NULL, NULL, false},
-    {"shmem_getmem_nbi", "bibw", bench_shmem_getmem_nbi_bibw, NULL, NULL, false},
+/* Number of result rows (message sizes) of the running benchmark */
+static int bench_num_rows = 0;
 
-    {"shmem_alltoall", "bw", bench_shmem_alltoall_bw, NULL, NULL, false},
-    {"shmem_alltoallmem", "bw", bench_shmem_alltoallmem_bw, NULL, NULL, false},
+/* Distribution of each committed result row */
+static sample_stats_t *bench_row_stats = NULL;
 
-    {"shmem_alltoalls", "bw", bench_shmem_alltoalls_bw, NULL, NULL, false},
-    {"shmem_alltoallsmem", "bw", bench_shmem_alltoallsmem_bw, NULL, NULL, false},
+/**
+  @brief Allocate sample storage for a whole run up front
+  @param ntimes Number of operations that can be sampled per message size
+  @return True if the storage could be allocated, false otherwise
+ */
+static bool bench_sample_setup(int ntimes) {
+  bench_row_stats =
+      (sample_stats_t *)calloc(bench_num_rows, sizeof(sample_stats_t));
+  if (bench_row_stats == NULL || !sample_buffer_init(&bench_samples, ntimes)) {
+    free(bench_row_stats);
+    bench_row_stats = NULL;
+    return false;
+  }
+  return true;
+}
+
+/**
+  @brief Release the sample storage allocated by bench_sample_setup
+ */
+static void bench_sample_teardown(void) {
+  sample_buffer_free(&bench_samples);
+  free(bench_row_stats);
+  bench_row_stats = NULL;
+}
+
+/**
+  @brief Reduce the recorded samples to a distribution for one result row
+  @param row Index of the message size (row) the samples belong to
+  @param transfers One-way transfers each sample spans (e.g. 2 for a
+  ping-pong round trip); the distribution is reported per transfer
+ */
+void bench_sample_commit(int row, int transfers) {
+  if (!bench_sampling || row < 0 || row >= bench_num_rows) {
+    return;
+  }
+  sample_stats_t *st = &bench_row_stats[row];
+  compute_sample_stats(&bench_samples, st);
+
+  /* Every sample contains one timer read; optionally take it back out */
+  double overhead = timer_overhead_us();
+  if (overhead > 0.0) {
+    st->min = fmax(st->min - overhead, 0.0);
+    st->p50 = fmax(st->p50 - overhead, 0.0);
+    st->p90 = fmax(st->p90 - overhead, 0.0);
+    st->p99 = fmax(st->p99 - overhead, 0.0);
+    st->p999 = fmax(st->p999 - overhead, 0.0);
+    st->max = fmax(st->max - overhead, 0.0);
+    st->mean = fmax(st->mean - overhead, 0.0);
+  }
+
+  if (transfers > 1) {
+    st->min /= transfers;
+    st->p50 /= transfers;
+    st->p90 /= transfers;
+    st->p99 /= transfers;
+    st->p999 /= transfers;
+    st->max /= transfers;
+    st->mean /= transfers;
+    st->stddev /= transfers;
+  }
+}
+
+/* Cross-PE timing: symmetric exchange buffers, every PE's time per row
+   and the min/avg/max summary of each row */
+static double *bench_pe_local = NULL;
+static double *bench_pe_all = NULL;
+#if defined(USE_14)
+static long *bench_pe_psync = NULL;
+#endif
+static double *bench_pe_times = NULL;
+static pe_summary_t *bench_pe_summary = NULL;
+static bool bench_pe_table = false;
+
+/**
+  @brief Allocate the buffers used to gather every PE's timing
+  @return True if the buffers could be allocated, false otherwise
+ */
+static bool bench_aggregate_setup(void) {
+  int npes = shmem_n_pes();
+
+  bench_pe_local = (double *)shmem_malloc(sizeof(double));
+  bench_pe_all = (double *)shmem_malloc(npes * sizeof(double));
+#if defined(USE_14)
+  bench_pe_psync = (long *)shmem_malloc(SHMEM_COLLECT_SYNC_SIZE * sizeof(long));
+  if (bench_pe_psync == NULL) {
+    return false;
+  }
+  for (int i = 0; i < SHMEM_COLLECT_SYNC_SIZE; i++) {
+    bench_pe_psync[i] = SHMEM_SYNC_VALUE;
+  }
+  shmem_barrier_all();
+#endif
+  bench_pe_times = (double *)calloc(bench_num_rows * npes, sizeof(double));
+  bench_pe_summary =
+      (pe_summary_t *)calloc(bench_num_rows, sizeof(pe_summary_t));
+
+  return bench_pe_local != NULL && bench_pe_all != NULL &&
+         bench_pe_times != NULL && bench_pe_summary != NULL;
+}
+
+/**
+  @brief Release the buffers allocated by bench_aggregate_setup
+ */
+static void bench_aggregate_teardown(void) {
+  shmem_barrier_all();
+  shmem_free(bench_pe_local);
+  shmem_free(bench_pe_all);
+#if defined(USE_14)
+  shmem_free(bench_pe_psync);
+  bench_pe_psync = NULL;
+#endif
+  free(bench_pe_times);
+  free(bench_pe_summary);
+  bench_pe_local = bench_pe_all = bench_pe_times = NULL;
+  bench_pe_summary = NULL;
+}
+
+/**
+  @brief Gather every PE's time for one result row and summarize it.
+  Must be called by all PEs, once per row.
+  @param row Index of the message size (row) the time belongs to
+  @param time Time per operation measured on this PE in microseconds
+  @param active True if this PE issued the timed operations; idle PEs
+  (e.g. the target of a one-sided put) are left out of the summary
+ */
+void bench_aggregate_times(int row, double time, bool active) {
+  if (row < 0 || row >= bench_num_rows) {
+    return;
+  }
+
+  int npes = shmem_n_pes();
+  *bench_pe_local = active ? time : -1.0;
+
+  /* Make sure nobody is still using the buffers from the previous row */
+  shmem_barrier_all();
+#if defined(USE_14)
+  shmem_fcollect64(bench_pe_all, bench_pe_local, 1, 0, 0, npes,
+                   bench_pe_psync);
+#elif defined(USE_15)
+  shmem_fcollect(SHMEM_TEAM_WORLD, bench_pe_all, bench_pe_local, 1);
+#endif
+
+  pe_summary_t *sum = &bench_pe_summary[row];
+  memset(sum, 0, sizeof(*sum));
+  double total = 0.0;
+  for (int pe = 0; pe < npes; pe++) {
+    double t = bench_pe_all[pe];
+    bench_pe_times[row * npes + pe] = t;
+    if (t < 0.0) {
+      continue;
+    }
+    if (sum->active == 0 || t < sum->min) {
+      sum->min = t;
+    }
+    if (sum->active == 0 || t > sum->max) {
+      sum->max = t;
+      sum->slowest_pe = pe;
+    }
+    total += t;
+    sum->active++;
+  }
+  sum->avg = (sum->active > 0) ? total / sum->active : 0.0;
+}
+
+/**
+  @brief Get the cross-PE summary of one result row
+  @param row Index of the row
+  @return Summary of the row, or NULL if the row does not exist
+ */
+const pe_summary_t *bench_pe_row(int row) {
+  if (bench_pe_summary == NULL || row < 0 || row >= bench_num_rows) {
+    return NULL;
+  }
+  return &bench_pe_summary[row];
+}
+
+/* Multi-pair mode (see --pairs): partner of every PE, the pairs as
+   (initiator, partner) and every pair's bandwidth per row */
+static pair_policy_t bench_pair_policy = PAIRS_NONE;
+static int *bench_partner = NULL;
+static int *bench_pair_pes = NULL;
+static int bench_num_pairs = 0;
+static double *bench_pair_bw = NULL;
+
+/**
+  @brief Split the PEs into pairs for the point-to-point benchmarks
+  @param policy Pairing policy of --pairs
+  @return True if the pairs could be set up, false otherwise
+ */
+static bool bench_pairs_setup(pair_policy_t policy) {
+  int npes = shmem_n_pes();
+
+  bench_pair_policy = policy;
+  bench_partner = (int *)malloc(npes * sizeof(int));
+  bench_pair_pes = (int *)malloc(npes * sizeof(int));
+  bench_pair_bw = (double *)calloc(bench_num_rows * (npes / 2 + 1),
+                                   sizeof(double));
+  if (bench_partner == NULL || bench_pair_pes == NULL ||
+      bench_pair_bw == NULL) {
+    return false;
+  }
+
+  bench_num_pairs = pairs_build(policy, bench_partner);
+  int p = 0;
+  for (int pe = 0; pe < npes; pe++) {
+    if (bench_partner[pe] > pe) {
+      bench_pair_pes[2 * p] = pe;
+      bench_pair_pes[2 * p + 1] = bench_partner[pe];
+      p++;
+    }
+  }
+  return true;
+}
+
+/**
+  @brief Release the state allocated by bench_pairs_setup
+ */
+static void bench_pairs_teardown(void) {
+  free(bench_partner);
+  free(bench_pair_pes);
+  free(bench_pair_bw);
+  bench_partner = bench_pair_pes = NULL;
+  bench_pair_bw = NULL;
+  bench_num_pairs = 0;
+  bench_pair_policy = PAIRS_NONE;
+}
+
+/**
+  @brief Check whether the point-to-point benchmarks run on many pairs
+  @return True if --pairs was given
+ */
+bool bench_multipair(void) { return bench_pair_policy != PAIRS_NONE; }
+
+/**
+  @brief Get the number of pairs formed by --pairs
+  @return Number of pairs, or 0 without --pairs
+ */
+int bench_pair_count(void) { return bench_num_pairs; }
+
+/**
+  @brief Get the partner of this PE under --pairs
+  @return Partner PE, or -1 if this PE was left out of the pairs
+ */
+int bench_pair_peer(void) {
+  return (bench_partner != NULL) ? bench_partner[shmem_my_pe()] : -1;
+}
+
+/**
+  @brief Compute the bandwidth of every pair for one result row from the
+  gathered per-PE times. Call after bench_aggregate_times for the row.
+  @param row Index of the row
+  @param bytes Bytes one operation moves
+  @return Aggregate bandwidth over all pairs in MB/s
+ */
+double bench_pair_commit(int row, size_t bytes) {
+  if (bench_pair_bw == NULL || row < 0 || row >= bench_num_rows) {
+    return 0.0;
+  }
+
+  const double *times = &bench_pe_times[row * shmem_n_pes()];
+  double *bw = &bench_pair_bw[row * bench_num_pairs];
+  double total = 0.0;
+  for (int p = 0; p < bench_num_pairs; p++) {
+    /* Each PE of the pair that issued operations adds its own bandwidth */
+    bw[p] = 0.0;
+    for (int k = 0; k < 2; k++) {
+      double t = times[bench_pair_pes[2 * p + k]];
+      if (t > 0.0) {
+        bw[p] += calculate_bw(bytes, t);
+      }
+    }
+    total += bw[p];
+  }
+  return total;
+}
+
+/* Overlap rows: time per operation of the transfer alone, of the compute
+   loop alone, and the share of the transfer hidden behind compute */
+static double *bench_row_pure = NULL;
+static double *bench_row_compute = NULL;
+static double *bench_row_overlap = NULL;
+
+/**
+  @brief Record the timings of one overlap row and compute the share of the
+  transfer hidden behind compute
+  @param row Index of the row
+  @param pure Time per operation of the transfer alone in microseconds
+  @param compute Time per operation of the compute loop alone
+  @param overall Time per operation of issue, compute and completion
+  @return Overlap in percent, from 0 (none) to 100 (fully hidden)
+ */
+double bench_overlap_commit(int row, double pure, double compute,
+                            double overall) {
+  /* Whatever the compute did not hide still shows up on top of it */
+  double overlap = 0.0;
+  if (pure > 0.0) {
+    overlap = 100.0 * (1.0 - (overall - compute) / pure);
+    overlap = fmin(fmax(overlap, 0.0), 100.0);
+  }
+
+  if (bench_row_overlap != NULL && row >= 0 && row < bench_num_rows) {
+    bench_row_pure[row] = pure;
+    bench_row_compute[row] = compute;
+    bench_row_overlap[row] = overlap;
+  }
+  return overlap;
+}
+
+/* Side-by-side rows: time per operation and bandwidth of the alternative
+   an op is compared against */
+static double *bench_row_compare_us = NULL;
+static double *bench_row_compare_bw = NULL;
+
+/**
+  @brief Record the alternative an op is compared against on one row
+  @param row Index of the row
+  @param time Time per operation of the alternative in microseconds
+  @param bw Bandwidth of the alternative in MB/s
+ */
+void bench_compare_commit(int row, double time, double bw) {
+  if (bench_row_compare_us != NULL && row >= 0 && row < bench_num_rows) {
+    bench_row_compare_us[row] = time;
+    bench_row_compare_bw[row] = bw;
+  }
+}
+
+/* Alignment rows: bandwidth of every row at every offset of the sweep,
+   and the sweep recorded last */
+static double *bench_align_bw = NULL;
+static int bench_align_pass = -1;
+
+/**
+  @brief Record the bandwidth of one row of an alignment sweep
+  @param pass Index of the sweep's offset in bench_align_offsets
+  @param row Index of the row
+  @param bw Bandwidth of the row in MB/s
+ */
+void bench_align_commit(int pass, int row, double bw) {
+  if (bench_align_bw != NULL && pass >= 0 && pass < BENCH_ALIGN_OFFSETS &&
+      row >= 0 && row < bench_num_rows) {
+    bench_align_bw[pass * bench_num_rows + row] = bw;
+    bench_align_pass = pass;
+  }
+}
+
+/**
+  @brief Get the bandwidth one offset of the alignment sweep loses against
+  the aligned sweep (offset 0) on one row
+  @param pass Index of the offset in bench_align_offsets
+  @param row Index of the row
+  @return Penalty in percent of the aligned bandwidth (negative if faster)
+ */
+static double bench_align_penalty(int pass, int row) {
+  double base = bench_align_bw[row];
+  if (base <= 0.0) {
+    return 0.0;
+  }
+  return 100.0 * (1.0 - bench_align_bw[pass * bench_num_rows + row] / base);
+}
+
+/* Ordering rows: time per operation of every row under every --ordering
+   semantic */
+static double *bench_ordering_us = NULL;
+
+/**
+  @brief Record the time per operation of one row under one --ordering
+  semantic
+  @param pass Index of the semantic in bench_orderings
+  @param row Index of the row
+  @param time Time per operation in microseconds
+ */
+void bench_ordering_commit(int pass, int row, double time) {
+  if (bench_ordering_us != NULL && pass >= 0 && pass < MAX_ORDERINGS &&
+      row >= 0 && row < bench_num_rows) {
+    bench_ordering_us[pass * bench_num_rows + row] = time;
+  }
+}
+
+/* Warmup settings applied to every benchmark (see --warmup) */
+static int bench_warmup_iters = 0;
+static bool bench_warmup_auto = false;
+
+/* Symmetric flag used by bench_agree() to share PE 0's decisions */
+static int *bench_agree_flag = NULL;
+
+/**
+  @brief Make every PE follow PE 0's decision.
+  Must be called by all PEs so loops that contain collectives stop after the
+  same number of passes everywhere.
+  @param decision This PE's decision
+  @return PE 0's decision
+ */
+static bool bench_agree(bool decision) {
+  *bench_agree_flag = decision;
+  shmem_barrier_all();
+  decision = shmem_int_g(bench_agree_flag, 0) != 0;
+  shmem_barrier_all();
+  return decision;
+}
+
+/**
+  @brief Check that every PE can reach its peer's symmetric memory with
+  plain loads and stores through shmem_ptr. Must be called by all PEs.
+  @param peer Peer of this PE, or -1 if it has none
+  @return True on every PE if all of them can
+ */
+bool bench_ptr_reachable(int peer) {
+  bool reachable = peer < 0 || shmem_ptr(bench_agree_flag, peer) != NULL;
+
+  /* Any PE that cannot reach its peer clears PE 0's flag */
+  *bench_agree_flag = 1;
+  shmem_barrier_all();
+  if (!reachable) {
+    shmem_int_atomic_set(bench_agree_flag, 0, 0);
+  }
+  shmem_barrier_all();
+  reachable = shmem_int_g(bench_agree_flag, 0) != 0;
+  shmem_barrier_all();
+  return reachable;
+}
+
+/* State of the warmup phase currently in progress */
+static struct {
+  bool collective;  /* All PEs must run the same number of iterations */
+  bool fixed_done;  /* The fixed --warmup N window has been handed out */
+  bool in_fixed;    /* The window being run is the fixed one */
+  bool converged;   /* Steady state reached (or budget exhausted) */
+  int windows;      /* Number of steady-state windows run so far */
+  double prev_mean; /* Mean time per operation of the previous window */
+  double elapsed;   /* Total time spent in steady-state windows */
+} warmup;
+
+/**
+  @brief Start the untimed warmup phase of a benchmark
+  @param collective True if every PE takes part in each operation, so all
+  PEs have to agree on when the steady state is reached
+ */
+void bench_warmup_begin(bool collective) {
+  memset(&warmup, 0, sizeof(warmup));
+  warmup.collective = collective;
+}
+
+/**
+  @brief Get the number of untimed operations to run in the next window
+  @return Operations in the next window, or 0 when warmup is over
+ */
+int bench_warmup_next(void) {
+  /* The fixed part of the warmup always runs first, as a single window */
+  if (!warmup.fixed_done) {
+    warmup.fixed_done = true;
+    if (bench_warmup_iters > 0) {
+      warmup.in_fixed = true;
+      return bench_warmup_iters;
+    }
+  }
+
+  warmup.in_fixed = false;
+  if (!bench_warmup_auto || warmup.converged) {
+    return 0;
+  }
+  return WARMUP_WINDOW;
+}
+
+/**
+  @brief Feed back the duration of the window that just ran.
+  In auto mode the warmup is over once two consecutive window means are
+  within WARMUP_TOLERANCE of each other, or the window/time budget is spent.
+  @param elapsed Time taken by the window in seconds
+ */
+void bench_warmup_end_window(double elapsed) {
+  if (warmup.in_fixed) {
+    return;
+  }
+
+  double mean = elapsed / WARMUP_WINDOW;
+  warmup.windows++;
+  warmup.elapsed += elapsed;
+
+  bool done = (warmup.windows > 1 &&
+               fabs(mean - warmup.prev_mean) <=
+                   WARMUP_TOLERANCE * warmup.prev_mean) ||
+              warmup.windows >= WARMUP_MAX_WINDOWS ||
+              warmup.elapsed >= WARMUP_MAX_SECONDS;
+  warmup.prev_mean = mean;
+
+  /* Collectives would deadlock if PEs stopped after different windows, so
+     everyone follows PE 0's decision */
+  if (warmup.collective) {
+    done = bench_agree(done);
+  }
+  warmup.converged = done;
+}
+
+/* Adaptive iteration settings applied to every benchmark (see --target-ci
+   and --max-time) */
+static bool bench_adaptive = false;
+static double bench_target_ci = 0.0;
+static double bench_max_time = 0.0;
+
+/* Operations timed and relative 95% CI half-width of each result row */
+static long *bench_row_iters = NULL;
+static double *bench_row_ci = NULL;
+
+/* State of the measurement currently in progress */
+static struct {
+  int batches;     /* Number of timed batches so far */
+  long ops;        /* Operations timed over all batches */
+  double elapsed;  /* Timed seconds over all batches */
+  double sum;      /* Sum of the batch means (us per operation) */
+  double sumsq;    /* Sum of the squared batch means */
+  double start;    /* Timestamp the measurement started at */
+} measure;
+
+/**
+  @brief Relative half-width of the 95% confidence interval of the mean
+  @return Half-width as a percentage of the mean, or -1.0 if fewer than two
+  batches have been timed
+ */
+static double bench_measure_ci(void) {
+  int n = measure.batches;
+  if (n < 2) {
+    return -1.0;
+  }
+  double mean = measure.sum / n;
+  double var = (measure.sumsq - n * mean * mean) / (n - 1);
+  if (mean <= 0.0) {
+    return 0.0;
+  }
+  double half = student_t_975(n - 1) * sqrt(fmax(var, 0.0) / n);
+  return 100.0 * half / mean;
+}
+
+/**
+  @brief Start timing the batches of one result row
+ */
+void bench_measure_begin(void) {
+  memset(&measure, 0, sizeof(measure));
+  measure.start = mysecond();
+  if (bench_sampling) {
+    sample_buffer_reset(&bench_samples, measure.start);
+  }
+}
+
+/**
+  @brief Feed back one timed batch and decide whether to time another.
+  Without --target-ci/--max-time a single batch is timed. Otherwise batches
+  are timed until the 95% CI of the mean is within the target (after at
+  least MEASURE_MIN_BATCHES), the time budget is spent or MEASURE_MAX_BATCHES
+  is reached. Must be called by all PEs; everyone follows PE 0.
+  @param elapsed Time taken by the batch in seconds
+  @param ops Number of operations in the batch
+  @return True if another batch should be timed
+ */
+bool bench_measure_batch(double elapsed, int ops) {
+  double mean = (ops > 0) ? elapsed * 1e6 / ops : 0.0;
+  measure.batches++;
+  measure.ops += ops;
+  measure.elapsed += elapsed;
+  measure.sum += mean;
+  measure.sumsq += mean * mean;
+
+  if (!bench_adaptive) {
+    return false;
+  }
+
+  double ci = bench_measure_ci();
+  bool done = measure.batches >= MEASURE_MAX_BATCHES ||
+              mysecond() - measure.start >= bench_max_time ||
+              (measure.batches >= MEASURE_MIN_BATCHES && ci >= 0.0 &&
+               ci <= bench_target_ci);
+  return !bench_agree(done);
+}
 
-    {"shmem_broadcast", "bw", bench_shmem_broadcast_bw, NULL, NULL, false},
-    {"shmem_broadcastmem", "bw", bench_shmem_broadcastmem_bw, NULL, NULL, false},
+/**
+  @brief Finish the measurement of one result row
+  @param row Index of the message size (row) being measured
+  @return Average time per operation over all batches in microseconds
+ */
+double bench_measure_end(int row) {
+  if (row >= 0 && row < bench_num_rows) {
+    bench_row_iters[row] = measure.ops;
+    bench_row_ci[row] = bench_measure_ci();
+  }
+  return (measure.ops > 0) ? measure.elapsed * 1e6 / measure.ops : 0.0;
+}
 
-    {"shmem_collect", "bw", bench_shmem_collect_bw, NULL, NULL, false},
-    {"shmem_collectmem", "bw", bench_shmem_collectmem_bw, NULL, NULL, false},
+/**
+  @brief Get the number of operations timed for one result row
+  @param row Index of the row
+  @return Operations timed over all batches of the row
+ */
+long bench_measure_iters(int row) {
+  if (bench_row_iters == NULL || row < 0 || row >= bench_num_rows) {
+    return 0;
+  }
+  return bench_row_iters[row];
+}
 
-    {"shmem_fcollect", "bw", bench_shmem_fcollect_bw, NULL, NULL, false},
-    {"shmem_fcollectmem", "bw", bench_shmem_fcollectmem_bw, NULL, NULL, false},
+/**
+  @brief Match a name against a comma-separated list of names or glob
+  patterns
+  @param list Comma-separated names, glob patterns (e.g. "shmem_atomic_*")
+  or "all"
+  @param name Name to match
+  @return True if some entry of the list matches
+ */
+static bool bench_list_match(const char *list, const char *name) {
+  char pattern[128];
+  const char *p = list;
+  while (*p != '\0') {
+    size_t len = strcspn(p, ",");
+    if (len > 0 && len < sizeof(pattern)) {
+      memcpy(pattern, p, len);
+      pattern[len] = '\0';
+      if (strcmp(pattern, "all") == 0 || fnmatch(pattern, name, 0) == 0) {
+        return true;
+      }
+    }
+    p += len;
+    if (*p == ',') {
+      p++;
+    }
+  }
+  return false;
+}
 
-    {"shmem_barrier_all", "latency", NULL, NULL,
-     bench_shmem_barrier_all_latency, false},
+/**
+  @brief Check whether a table entry is selected by --bench and --benchtype
+  @param entry Op descriptor of benchmark_table
+  @param benchmark Comma-separated benchmark names, glob patterns
+  (e.g. "shmem_atomic_*") or "all"
+  @param benchtype Requested benchtype, or NULL for each benchmark's default
+  (the first benchtype listed for it in the table)
+  @return True if the entry should run
+ */
+static bool bench_selected(const bench_op_t *entry,
+                           const char *benchmark, const char *benchtype) {
+  if (benchtype != NULL) {
+    if (strcmp(entry->benchtype, benchtype) != 0) {
+      return false;
+    }
+  } else {
+    for (int i = 0; benchmark_table[i] != entry; i++) {
+      if (strcmp(benchmark_table[i]->benchmark, entry->benchmark) == 0) {
+        return false;
+      }
+    }
+  }
+  return bench_list_match(benchmark, entry->benchmark);
+}
 
-    {"shmem_atomic_add", "latency", NULL, NULL, bench_shmem_atomic_add_latency,
-     false},
-    {"shmem_atomic_compare_swap", "latency", NULL, NULL,
-     bench_shmem_atomic_compare_swap_latency, false},
-    {"shmem_atomic_fetch_nbi", "latency", NULL, NULL,
-     bench_shmem_atomic_fetch_nbi_latency, false},
-    {"shmem_atomic_fetch", "latency", NULL, NULL,
-     bench_shmem_atomic_fetch_latency, false},
-    {"shmem_atomic_inc", "latency", NULL, NULL, bench_shmem_atomic_inc_latency,
-     false},
-    {"shmem_atomic_set", "latency", NULL, NULL, bench_shmem_atomic_set_latency,
-     false},
-    {"shmem_atomic_swap", "latency", NULL, NULL,
-     bench_shmem_atomic_swap_latency, false}};
+/**
+  @brief Get the op a selected table entry runs as: the entry itself, or
+  with --type its typed variants of the selected types
+  @param entry Op descriptor of benchmark_table
+  @param types Comma-separated element types of --type, or NULL
+  @param k Index of the variant
+  @return Variant k, or NULL past the last one
+ */
+static const bench_op_t *bench_variant(const bench_op_t *entry,
+                                       const char *types, int k) {
+  if (types == NULL || entry->typed == NULL) {
+    return (k == 0) ? entry : NULL;
+  }
+  for (int i = 0; entry->typed[i] != NULL; i++) {
+    if (bench_list_match(types, entry->typed[i]->type) && k-- == 0) {
+      return entry->typed[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+  @brief Run one benchmark in its own section
+  @param op Op descriptor of the benchmark
+  @param run Position of the section
+  @param total Number of sections
+  @param max_msg_size Largest message size of the sweep in bytes
+  @param ntimes Operations per timed batch
+ */
+static void bench_run_section(const bench_op_t *op, int run, int total,
+                              size_t max_msg_size, int ntimes) {
+  /* Nobody starts the next benchmark before the previous one is done */
+  shmem_barrier_all();
+  bench_current = op;
+  bench_align_pass = -1;
+  if (shmem_my_pe() == 0 && report_is_text()) {
+    char title[128];
+    FILE *out = report_stream();
+    snprintf(title, sizeof(title), "[%d/%d] %s (%s)", run, total,
+             op->benchmark, op->benchtype);
+    fprintf(out, "==============================================\n");
+    fprintf(out, "=== %-38s ===\n", title);
+    fprintf(out, "==============================================\n\n");
+  }
+
+  bench_engine_run(op, max_msg_size, ntimes);
+
+  /* Release the pooled buffers sized for this benchmark */
+  shmem_barrier_all();
+  bufpool_finalize();
+}
 
 /**
-  @brief Run the selected benchmark
-  @param benchmark The benchmark to be run (e.g., "shmem_put", "shmem_get")
+  @brief Run every selected benchmark, each in its own section
+  @param benchmark Comma-separated benchmarks to run, glob patterns
+  (e.g. "shmem_atomic_*") or "all"
   @param benchtype The type of benchmark to run, either "bw", "bibw", or
- "latency"
-  @param min_msg_size Minimum message size for test in bytes
+ "latency", or NULL for each benchmark's default
   @param max_msg_size Maximum message size for test in bytes
   @param ntimes Number of times the benchmark should run
-  @param stride Stride value to use for the benchmark (only used if applicable)
- */
-void run_benchmark(char *benchmark, char *benchtype, int min_msg_size,
-                   int max_msg_size, int ntimes, int stride) {
-  for (int i = 0; i < sizeof(benchmark_table) / sizeof(benchmark_entry_t);
-       i++) {
-    if (strcmp(benchmark, benchmark_table[i].benchmark) == 0 &&
-        strcmp(benchtype, benchmark_table[i].benchtype) == 0) {
-      if (benchmark_table[i].uses_stride) {
-        benchmark_table[i].func_with_stride(min_msg_size, max_msg_size, ntimes,
-                                            stride);
-      } else if (benchmark_table[i].func != NULL) {
-        benchmark_table[i].func(min_msg_size, max_msg_size, ntimes);
-      } else if (benchmark_table[i].func_no_size != NULL) {
-        benchmark_table[i].func_no_size(ntimes);
+  @param opts Parsed runtime options (measurement modes; the strided
+  benchmarks sweep every stride of opts)
+ */
+void run_benchmark(char *benchmark, char *benchtype, size_t max_msg_size,
+                   int ntimes, const options *opts) {
+  /* One row per message size, and at least one for size-less benchmarks */
+  bench_num_rows = bench_sizes.count;
+  if (bench_num_rows == 0) {
+    bench_num_rows = 1;
+  }
+
+  /* Buffers used to gather every PE's timing after each message size */
+  bench_pe_table = opts->pe_table;
+  if (!bench_aggregate_setup()) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr, "PE %d: shmem_malloc failed\n", shmem_my_pe());
+    }
+    shmem_global_exit(1);
+  }
+
+  /* Adaptive mode times extra batches; a missing target or budget falls
+     back to its default */
+  bench_adaptive = opts->target_ci > 0.0 || opts->max_time > 0.0;
+  bench_target_ci =
+      (opts->target_ci > 0.0) ? opts->target_ci : MEASURE_DEFAULT_TARGET_CI;
+  bench_max_time =
+      (opts->max_time > 0.0) ? opts->max_time : MEASURE_DEFAULT_MAX_TIME;
+  bench_row_iters = (long *)calloc(bench_num_rows, sizeof(long));
+  bench_row_ci = (double *)calloc(bench_num_rows, sizeof(double));
+  if (bench_row_iters == NULL || bench_row_ci == NULL) {
+    fprintf(stderr, "PE %d: Unable to allocate iteration counts\n",
+            shmem_my_pe());
+    shmem_global_exit(1);
+  }
+
+  /* Timings behind the overlap percentage of each row */
+  bench_row_pure = (double *)calloc(bench_num_rows, sizeof(double));
+  bench_row_compute = (double *)calloc(bench_num_rows, sizeof(double));
+  bench_row_overlap = (double *)calloc(bench_num_rows, sizeof(double));
+  if (bench_row_pure == NULL || bench_row_compute == NULL ||
+      bench_row_overlap == NULL) {
+    fprintf(stderr, "PE %d: Unable to allocate overlap results\n",
+            shmem_my_pe());
+    shmem_global_exit(1);
+  }
+
+  /* Results of the alternatives compared side by side */
+  bench_row_compare_us = (double *)calloc(bench_num_rows, sizeof(double));
+  bench_row_compare_bw = (double *)calloc(bench_num_rows, sizeof(double));
+  if (bench_row_compare_us == NULL || bench_row_compare_bw == NULL) {
+    fprintf(stderr, "PE %d: Unable to allocate comparison results\n",
+            shmem_my_pe());
+    shmem_global_exit(1);
+  }
+
+  /* Bandwidth of every offset of the alignment sweep */
+  bench_align_bw =
+      (double *)calloc(BENCH_ALIGN_OFFSETS * bench_num_rows, sizeof(double));
+  if (bench_align_bw == NULL) {
+    fprintf(stderr, "PE %d: Unable to allocate alignment results\n",
+            shmem_my_pe());
+    shmem_global_exit(1);
+  }
+
+  /* Time per operation of every ordering semantic */
+  bench_ordering_us =
+      (double *)calloc(MAX_ORDERINGS * bench_num_rows, sizeof(double));
+  if (bench_ordering_us == NULL) {
+    fprintf(stderr, "PE %d: Unable to allocate ordering results\n",
+            shmem_my_pe());
+    shmem_global_exit(1);
+  }
+
+  /* Preallocate per-operation sample storage before anything is timed;
+     a batch of a windowed op is ntimes windows of operations */
+  int max_window = 1;
+  for (int i = 0; i < opts->num_windows; i++) {
+    if (opts->windows[i] > max_window) {
+      max_window = opts->windows[i];
+    }
+  }
+  long needed = (long)ntimes * max_window;
+  if (bench_adaptive) {
+    needed *= MEASURE_MAX_BATCHES;
+  }
+  long capacity = (needed > MEASURE_MAX_SAMPLES) ? MEASURE_MAX_SAMPLES
+                                                 : needed;
+  bench_sampling = opts->percentiles;
+  if (bench_sampling && !bench_sample_setup((int)capacity)) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr, "Warning: Unable to allocate sample storage, "
+                      "percentiles disabled.\n");
+    }
+    bench_sampling = false;
+  }
+  if (bench_sampling && capacity < needed && shmem_my_pe() == 0) {
+    fprintf(stderr,
+            "Warning: Up to %ld operations per row but room for %ld "
+            "samples; percentiles cover the first %ld operations of "
+            "larger rows.\n",
+            needed, capacity, capacity);
+  }
+
+  /* Point-to-point benchmarks run on every pair at once with --pairs */
+  if (opts->pairs != PAIRS_NONE && !bench_pairs_setup(opts->pairs)) {
+    fprintf(stderr, "PE %d: Unable to allocate PE pairs\n", shmem_my_pe());
+    shmem_global_exit(1);
+  }
+
+  /* Message-rate benchmarks run one sweep per window */
+  memcpy(bench_windows, opts->windows, sizeof(bench_windows));
+  bench_num_windows = opts->num_windows;
+
+  /* Chunked transfers run one sweep per chunking */
+  memcpy(bench_chunks, opts->chunks, sizeof(bench_chunks));
+  bench_num_chunks = opts->num_chunks;
+
+  /* Point-to-point RMA runs one sweep per ordering semantic */
+  memcpy(bench_orderings, opts->orderings, sizeof(bench_orderings));
+  bench_num_orderings = opts->num_orderings;
+
+  /* Traffic benchmarks run one sweep per distribution */
+  memcpy(bench_traffic, opts->traffic, sizeof(bench_traffic));
+  bench_num_traffic = opts->num_traffic;
+  bench_traffic_reads = opts->traffic_reads;
+  bench_traffic_writes = opts->traffic_writes;
+  bench_zipf = opts->zipf;
+
+  /* Strided benchmarks run one sweep per stride */
+  memcpy(bench_strides, opts->strides, sizeof(bench_strides));
+  bench_num_strides = opts->num_strides;
+
+  /* Contiguous byte benchmarks shift their buffers by the offsets */
+  bench_src_offset = opts->src_offset;
+  bench_dst_offset = opts->dst_offset;
+
+  /* Cold runs rotate sized benchmarks through copies out of the cache */
+  bench_cache_ring = opts->cache_cold ? (size_t)opts->cache_ring : 0;
+
+  /* Benchmark buffers come from the pool unless --realloc-per-size */
+  bufpool_init(opts->realloc_per_size);
+
+  /* Every kernel picks up the same warmup settings */
+  bench_warmup_iters = opts->warmup;
+  bench_warmup_auto = opts->warmup_auto;
+  bench_agree_flag = (int *)shmem_malloc(sizeof(int));
+  if (bench_agree_flag == NULL) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr, "PE %d: shmem_malloc failed\n", shmem_my_pe());
+    }
+    shmem_global_exit(1);
+  }
+
+  /* Count the selected benchmarks so every section can show its position */
+  int total = 0;
+  for (int i = 0; i < BENCHMARK_TABLE_SIZE; i++) {
+    const bench_op_t *entry = benchmark_table[i];
+    if (bench_selected(entry, benchmark, benchtype)) {
+      for (int k = 0; bench_variant(entry, opts->types, k) != NULL; k++) {
+        total++;
+      }
+    }
+  }
+  if (total == 0 && shmem_my_pe() == 0) {
+    fprintf(stderr, "Error: Benchmark, benchtype or type not found.\n");
+  }
+
+  /* Run every selected benchmark in table order, one section each */
+  int run = 0;
+  for (int i = 0; i < BENCHMARK_TABLE_SIZE; i++) {
+    const bench_op_t *entry = benchmark_table[i];
+    if (!bench_selected(entry, benchmark, benchtype)) {
+      continue;
+    }
+
+    /* With --type the typed benchmarks run one variant per selected type,
+       and more than one variant is also compared by type */
+    int variants = 0;
+    while (bench_variant(entry, opts->types, variants) != NULL) {
+      variants++;
+    }
+    if (variants > 1) {
+      bench_type_rows =
+          (report_type_row_t *)calloc(variants, sizeof(report_type_row_t));
+      if (bench_type_rows == NULL) {
+        fprintf(stderr, "PE %d: Unable to allocate the type comparison\n",
+                shmem_my_pe());
+        shmem_global_exit(1);
       }
-      return;
+    }
+
+    for (int k = 0; k < variants; k++) {
+      bench_type_row = (bench_type_rows != NULL) ? k : -1;
+      bench_run_section(bench_variant(entry, opts->types, k), ++run, total,
+                        max_msg_size, ntimes);
+    }
+
+    if (bench_type_rows != NULL) {
+      if (shmem_my_pe() == 0) {
+        report_info_t info = {entry->benchmark, entry->benchtype, NULL, NULL,
+                              NULL};
+        report_emit_types(&info, bench_type_rows, variants);
+      }
+      free(bench_type_rows);
+      bench_type_rows = NULL;
+      bench_type_row = -1;
     }
   }
-  if (shmem_my_pe() == 0) {
-    fprintf(stderr, "Error: Benchmark or benchtype not found.\n");
+  bench_current = NULL;
+
+  shmem_barrier_all();
+  shmem_free(bench_agree_flag);
+  bench_agree_flag = NULL;
+  cache_finalize();
+
+  if (bench_sampling) {
+    bench_sample_teardown();
+    bench_sampling = false;
   }
+  bench_aggregate_teardown();
+  bench_pairs_teardown();
+  free(bench_row_iters);
+  free(bench_row_ci);
+  bench_row_iters = NULL;
+  bench_row_ci = NULL;
+  free(bench_row_pure);
+  free(bench_row_compute);
+  free(bench_row_overlap);
+  bench_row_pure = bench_row_compute = bench_row_overlap = NULL;
+  free(bench_row_compare_us);
+  free(bench_row_compare_bw);
+  bench_row_compare_us = bench_row_compare_bw = NULL;
+  free(bench_align_bw);
+  bench_align_bw = NULL;
+  free(bench_ordering_us);
+  bench_ordering_us = NULL;
+  bench_num_rows = 0;
 }
 
 /**
@@ -130,7 +1115,7 @@ void run_benchmark(char *benchmark, char *benchtype, int min_msg_size,
   @param time Time taken for the operation in microseconds
   @return The calculated bandwidth in MB/s
  */
-double calculate_bw(int size, double time) {
+double calculate_bw(size_t size, double time) {
   if (time <= 0.0) {
     return 0.0;
   }
@@ -155,7 +1140,7 @@ double calculate_bw(int size, double time) {
   @param time Time taken for the operation in microseconds
   @return The calculated bidirectional bandwidth in MB/s
  */
-double calculate_bibw(int size, double time) {
+double calculate_bibw(size_t size, double time) {
   if (time <= 0.0) {
     return 0.0;
   }
@@ -169,77 +1154,296 @@ double calculate_bibw(int size, double time) {
  */
 double calculate_latency(double time) { return time; }
 
+/**
+  @brief Fill in the measurement, cross-PE and sampling parts of a row
+  @param r Row to fill in
+  @param row Index of the measured row
+ */
+static void bench_report_row(report_row_t *r, int row) {
+  int npes = shmem_n_pes();
+  const pe_summary_t *pe = bench_pe_row(row);
+
+  r->iters = bench_measure_iters(row);
+  r->ci = (bench_adaptive && row < bench_num_rows) ? bench_row_ci[row] : -1.0;
+  if (pe != NULL) {
+    r->pe = *pe;
+  }
+  r->stats = (bench_sampling && row < bench_num_rows) ? &bench_row_stats[row]
+                                                      : NULL;
+  r->pe_times = (bench_pe_table && row < bench_num_rows)
+                    ? &bench_pe_times[row * npes]
+                    : NULL;
+
+  /* Overlap rows report the timings the percentage comes from */
+  r->overlap = -1.0;
+  if (bench_current != NULL && bench_current->overlap &&
+      row < bench_num_rows) {
+    r->pure_us = bench_row_pure[row];
+    r->compute_us = bench_row_compute[row];
+    r->overlap = bench_row_overlap[row];
+  }
+
+  /* Traffic rows report the updates of all PEs together: every PE issues
+     its own accesses, so their rates add up */
+  r->read_pct = -1.0;
+  if (bench_current != NULL && bench_current->uses_traffic &&
+      row < bench_num_rows) {
+    const double *times = &bench_pe_times[row * npes];
+    r->read_pct = 100.0 * bench_traffic_reads /
+                  (bench_traffic_reads + bench_traffic_writes);
+    r->msg_rate = 0.0;
+    for (int p = 0; p < npes; p++) {
+      if (times[p] > 0.0) {
+        r->msg_rate += 1e6 / times[p];
+      }
+    }
+    if (r->bandwidth >= 0.0) {
+      /* MiB/s, like calculate_bw */
+      r->bandwidth = r->msg_rate * (double)r->msg_size / (1024.0 * 1024.0);
+    }
+  }
+
+  /* Alignment rows report the bandwidth lost against offset 0 */
+  r->penalty = -1.0;
+  if (bench_current != NULL &&
+      strcmp(bench_current->benchtype, "align") == 0 &&
+      bench_align_pass >= 0 && row < bench_num_rows) {
+    r->penalty = bench_align_penalty(bench_align_pass, row);
+  }
+
+  /* Side-by-side rows report the alternative next to the op */
+  if (bench_current != NULL && bench_current->compare != NULL &&
+      row < bench_num_rows) {
+    r->compare_us = bench_row_compare_us[row];
+    r->compare_bw = bench_row_compare_bw[row];
+  }
+
+  /* Point-to-point bandwidth rows of --pairs report every pair and the
+     aggregate message rate of all PEs that issued operations */
+  if (bench_multipair() && bench_current != NULL &&
+      bench_current->pes == BENCH_EXACTLY_2_PES &&
+      strcmp(bench_current->benchtype, "latency") != 0 &&
+      !bench_current->overlap && row < bench_num_rows) {
+    const double *times = &bench_pe_times[row * npes];
+    r->pairs = bench_num_pairs;
+    r->pair_pes = bench_pair_pes;
+    r->pair_bw = &bench_pair_bw[row * bench_num_pairs];
+    r->msg_rate = 0.0;
+    for (int p = 0; p < npes; p++) {
+      if (times[p] > 0.0) {
+        r->msg_rate += 1e6 / times[p];
+      }
+    }
+  }
+}
+
+/**
+  @brief Get the name of the running benchmark for its results
+  @return Benchmark name, or "unknown" outside run_benchmark
+ */
+static const char *bench_current_name(void) {
+  return (bench_current != NULL) ? bench_current->benchmark : "unknown";
+}
+
 /**
   @param times Time array for benchmark timings
   @param msg_size Message size array
   @param results BW/Latency array
-  @param benchtype Either "bw", "bibw", or "latency"
+  @param benchtype Either "bw", "bibw", "mr", "latency", "overlap",
+  "pack", "align", "rma", "chase" or "updates"
   @param num_sizes Number of rows in the table
+  @param window Operations per completion of message-rate rows, or 0
+  @param chunks Pieces each transfer of chunked rows is split into, or 0
+  @param stride Stride of strided rows in elements, or 0
+  @param src_offset Bytes the source was shifted into its buffer
+  @param dst_offset Bytes the destination was shifted into its buffer
+  @param ordering Name of the --ordering semantic of the rows, or NULL
+  @param traffic Name of the --traffic distribution of the rows, or NULL
  */
-void display_results(double *times, int *msg_size, double *results,
-                     const char *benchtype, int num_sizes) {
-  printf("==============================================\n");
-  printf("===          Benchmark Results             ===\n");
-  printf("==============================================\n");
-
-  /* Print table headers based on the benchtype */
-  if (strcmp(benchtype, "bw") == 0 || strcmp(benchtype, "bibw") == 0) {
-    printf("%-16s %-16s %-14s\n", "Message Size", "Latency (us)", "Avg MB/s");
-  } else if (strcmp(benchtype, "latency") == 0) {
-    printf("%-16s %-16s\n", "Message Size", "Latency (us)");
+void display_results(double *times, size_t *msg_size, double *results,
+                     const char *benchtype, int num_sizes, int window,
+                     int chunks, int stride, int src_offset, int dst_offset,
+                     const char *ordering, const char *traffic) {
+  bool chase = strcmp(benchtype, "chase") == 0;
+  bool latency = strcmp(benchtype, "latency") == 0 || chase;
+  bool overlap = strcmp(benchtype, "overlap") == 0;
+  report_row_t *rows =
+      (report_row_t *)calloc(num_sizes > 0 ? num_sizes : 1,
+                             sizeof(report_row_t));
+  if (rows == NULL) {
+    fprintf(stderr, "Unable to allocate result rows\n");
+    return;
   }
 
-  /* Print each row of the table */
   for (int i = 0; i < num_sizes; i++) {
-    if (strcmp(benchtype, "latency") == 0) {
-      printf("%-16d %-16.2f\n", msg_size[i], results[i]);
-    } else {
-      printf("%-16d %-16.2f %-14.2f\n", msg_size[i], times[i], results[i]);
+    rows[i].msg_size = msg_size[i];
+    rows[i].window = window;
+    rows[i].chunks = chunks;
+    rows[i].ordering = ordering;
+    rows[i].traffic = traffic;
+    rows[i].stride = stride;
+    rows[i].src_offset = src_offset;
+    rows[i].dst_offset = dst_offset;
+    /* Strided rows count elements, pointer-chasing rows nodes per PE */
+    if ((stride > 0 || chase) && bench_current != NULL) {
+      size_t elem_size = bench_current->elem_size;
+      rows[i].elems = msg_size[i] / (elem_size > 1 ? elem_size : 1);
     }
+    rows[i].time_us = latency ? results[i] : times[i];
+    rows[i].bandwidth = (latency || overlap) ? -1.0 : results[i];
+    rows[i].msg_rate = (rows[i].time_us > 0.0) ? 1e6 / rows[i].time_us : 0.0;
+    bench_report_row(&rows[i], i);
+  }
+
+  report_info_t info = {bench_current_name(), benchtype, NULL, NULL, NULL};
+  if (bench_current != NULL && bench_current->compare != NULL) {
+    info.compare = bench_current->compare->benchmark;
+  }
+  if (bench_current != NULL) {
+    info.type = bench_current->type;
   }
+  report_emit(&info, rows, num_sizes);
 
-  printf("\n");
+  /* Typed variants compared by type keep a summary of their first sweep */
+  report_type_row_t *t =
+      (bench_type_rows != NULL && bench_type_row >= 0 && num_sizes > 0)
+          ? &bench_type_rows[bench_type_row]
+          : NULL;
+  if (t != NULL && t->benchmark == NULL) {
+    size_t elem_size = bench_current->elem_size;
+    t->benchmark = bench_current->benchmark;
+    t->type = bench_current->type;
+    t->elem_size = (int)(elem_size > 1 ? elem_size : 1);
+    t->stride = stride;
+    t->min_size = rows[0].msg_size;
+    t->min_us = rows[0].time_us;
+    for (int i = 0; i < num_sizes; i++) {
+      if (i == 0 || rows[i].bandwidth > t->peak_bw) {
+        t->peak_bw = rows[i].bandwidth;
+        t->peak_size = rows[i].msg_size;
+      }
+    }
+  }
+  free(rows);
 }
 
 /**
-  @brief Display results for atomic latency benchmarks
-  @param benchmark The name of the benchmark (e.g., "shmem_atomic_add")
-  @param total_time The total time taken for the operations in microseconds
-  @param ntimes The number of times the operation was performed
+  @brief Display the bandwidth penalty of every offset of the alignment
+  sweep at every message size, after the last sweep of an align op
+  @param msg_sizes Message size of each row
+  @param num_sizes Number of rows
  */
-void display_atomic_latency_results(const char *benchmark, double total_time,
-                                    int ntimes) {
-  double avg_time = total_time / ntimes;
+void display_align_results(const size_t *msg_sizes, int num_sizes) {
+  if (bench_align_bw == NULL || num_sizes > bench_num_rows) {
+    return;
+  }
+
+  double *penalty =
+      (double *)malloc(BENCH_ALIGN_OFFSETS * num_sizes * sizeof(double));
+  if (penalty == NULL) {
+    fprintf(stderr, "Unable to allocate the alignment penalties\n");
+    return;
+  }
+  for (int k = 0; k < BENCH_ALIGN_OFFSETS; k++) {
+    for (int i = 0; i < num_sizes; i++) {
+      penalty[k * num_sizes + i] = bench_align_penalty(k, i);
+    }
+  }
 
-  printf("==============================================\n");
-  printf("%s Latency        \n", benchmark);
-  printf("==============================================\n");
-  printf("Avg Time per Operation (us):   %.2f\n", avg_time);
-  printf("Total Time for %d Operations (us): %.2f\n", ntimes, total_time);
-  printf("==============================================\n");
+  report_info_t info = {bench_current_name(), "align", NULL, NULL, NULL};
+  report_emit_align(&info, msg_sizes, num_sizes, bench_align_offsets,
+                    BENCH_ALIGN_OFFSETS, penalty);
+  free(penalty);
 }
 
 /**
-  @return Current time in seconds
+  @brief Display the time per operation of every --ordering semantic at
+  every message size, after the last sweep of an op run once per semantic
+  @param msg_sizes Message size of each row
+  @param num_sizes Number of rows
+  @param orderings Semantic of each sweep
+  @param num_orderings Number of semantics
  */
-double mysecond(void) {
-  /* Use clock_gettime with CLOCK_MONOTONIC for higher resolution and to
-     avoid issues with system clock adjustments. Returns seconds as a
-     double. */
-#if defined(_POSIX_TIMERS) && !defined(__APPLE__)
-  struct timespec ts;
-  if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
-    return (double)ts.tv_sec + (double)ts.tv_nsec * 1.e-9;
+void display_ordering_results(const size_t *msg_sizes, int num_sizes,
+                              const ordering_t *orderings,
+                              int num_orderings) {
+  if (bench_ordering_us == NULL || num_sizes > bench_num_rows) {
+    return;
+  }
+
+  /* Rows of bench_ordering_us are laid out for bench_num_rows */
+  double *time_us = (double *)malloc(num_orderings * num_sizes *
+                                     sizeof(double));
+  const char **names =
+      (const char **)malloc(num_orderings * sizeof(const char *));
+  if (time_us == NULL || names == NULL) {
+    fprintf(stderr, "Unable to allocate the ordering costs\n");
+    free(time_us);
+    free(names);
+    return;
+  }
+  for (int k = 0; k < num_orderings; k++) {
+    names[k] = ordering_name(orderings[k]);
+    for (int i = 0; i < num_sizes; i++) {
+      time_us[k * num_sizes + i] = bench_ordering_us[k * bench_num_rows + i];
+    }
+  }
+
+  report_info_t info = {bench_current_name(), bench_current->benchtype, NULL,
+                        NULL, NULL};
+  report_emit_ordering(&info, msg_sizes, num_sizes, names, num_orderings,
+                       time_us);
+  free(time_us);
+  free(names);
+}
+
+/**
+  @brief Display the results of a size-less latency benchmark (atomics,
+  barrier) from row 0 of the measurement and cross-PE aggregation
+  @param op_name Noun for one operation in text output (e.g. "Barrier")
+  @param traffic Name of the --traffic distribution of the row, or NULL
+ */
+void display_latency_results(const char *op_name, const char *traffic) {
+  const pe_summary_t *pe = bench_pe_row(0);
+  if (pe == NULL) {
+    return;
+  }
+
+  report_row_t row;
+  memset(&row, 0, sizeof(row));
+  row.msg_size = REPORT_NO_SIZE;
+  row.traffic = traffic;
+  row.time_us = pe->avg;
+  row.bandwidth = -1.0;
+  row.msg_rate = (row.time_us > 0.0) ? 1e6 / row.time_us : 0.0;
+  bench_report_row(&row, 0);
+
+  const char *benchtype =
+      (bench_current != NULL) ? bench_current->benchtype : "latency";
+  report_info_t info = {bench_current_name(), benchtype, op_name, NULL,
+                        NULL};
+  if (bench_current != NULL && bench_current->compare != NULL) {
+    info.compare = bench_current->compare->benchmark;
+  }
+  if (bench_current != NULL) {
+    info.type = bench_current->type;
+  }
+  report_emit(&info, &row, 1);
+
+  /* Single-element typed variants compared by type report their one
+     element as both the smallest and the peak transfer */
+  report_type_row_t *t = (bench_type_rows != NULL && bench_type_row >= 0)
+                             ? &bench_type_rows[bench_type_row]
+                             : NULL;
+  if (t != NULL && t->benchmark == NULL) {
+    size_t elem_size = bench_current->elem_size;
+    t->benchmark = bench_current->benchmark;
+    t->type = bench_current->type;
+    t->elem_size = (int)(elem_size > 1 ? elem_size : 1);
+    t->min_size = t->peak_size = (size_t)t->elem_size;
+    t->min_us = row.time_us;
+    t->peak_bw = calculate_bw((size_t)t->elem_size, row.time_us);
   }
-  /* Fallback to gettimeofday if clock_gettime isn't available or fails. */
-  struct timeval tp;
-  gettimeofday(&tp, NULL);
-  return ((double)tp.tv_sec + (double)tp.tv_usec * 1.e-6);
-#else
-  struct timeval tp;
-  gettimeofday(&tp, NULL);
-  return ((double)tp.tv_sec + (double)tp.tv_usec * 1.e-6);
-#endif
 }
 
 /**
@@ -249,8 +1453,8 @@ double mysecond(void) {
 bool check_if_exactly_2_pes(void) {
   if (shmem_n_pes() != 2) {
     if (shmem_my_pe() == 0) {
-      printf(RED_COLOR "\nERROR: " RESET_COLOR "This test requires"
-                       " exactly 2 PEs!\n\n");
+      fprintf(stderr, RED_COLOR "\nERROR: " RESET_COLOR "This test requires"
+                              " exactly 2 PEs!\n\n");
     }
     return false;
   }
@@ -264,8 +1468,8 @@ bool check_if_exactly_2_pes(void) {
 bool check_if_atleast_2_pes(void) {
   if (!(shmem_n_pes() >= 2)) {
     if (shmem_my_pe() == 0) {
-      printf(RED_COLOR "\nERROR: " RESET_COLOR "This test requires"
-                       " at least 2 PEs!\n\n");
+      fprintf(stderr, RED_COLOR "\nERROR: " RESET_COLOR "This test requires"
+                              " at least 2 PEs!\n\n");
     }
     return false;
   }
@@ -273,10 +1477,8 @@ bool check_if_atleast_2_pes(void) {
 }
 
 /**
-  @brief Setup the benchmark by calculating the number of message
-         sizes and allocating arrays
-  @param min_msg_size Minimum message size for the benchmark in bytes
-  @param max_msg_size Maximum message size for the benchmark in bytes
+  @brief Setup the benchmark by taking the message sizes from the shared
+         schedule (bench_sizes) and allocating arrays
   @param num_sizes Pointer to store the number of message sizes
   @param msg_sizes Pointer to an array to store the message sizes
   @param times Pointer to an array to store the timing results
@@ -284,25 +1486,24 @@ bool check_if_atleast_2_pes(void) {
                 (e.g., bandwidth or latency)
   @return True if setup was successful, false otherwise
  */
-bool setup_bench(int min_msg_size, int max_msg_size, int *num_sizes,
-                 int **msg_sizes, double **times, double **results) {
-  /* Determine the number of message sizes */
-  *num_sizes = 0;
-  for (int size = min_msg_size; size <= max_msg_size; size *= 2) {
-    (*num_sizes)++;
-  }
+bool setup_bench(int *num_sizes, size_t **msg_sizes, double **times,
+                 double **results) {
+  /* Every sweep iterates the same schedule */
+  *num_sizes = bench_sizes.count;
 
   /* Allocate memory for arrays */
-  *msg_sizes = (int *)malloc(*num_sizes * sizeof(int));
+  *msg_sizes = (size_t *)malloc(*num_sizes * sizeof(size_t));
   *times = (double *)malloc(*num_sizes * sizeof(double));
   *results = (double *)malloc(*num_sizes * sizeof(double));
 
-  if (msg_sizes == NULL || times == NULL || results == NULL ||
-      !(num_sizes > 0)) {
-    printf(RED_COLOR "\nERROR: " RESET_COLOR "Unable to set up test!\n\n");
+  if (*msg_sizes == NULL || *times == NULL || *results == NULL ||
+      !(*num_sizes > 0)) {
+    fprintf(stderr,
+            RED_COLOR "\nERROR: " RESET_COLOR "Unable to set up test!\n\n");
     return false;
   }
 
+  memcpy(*msg_sizes, bench_sizes.sizes, *num_sizes * sizeof(size_t));
   return true;
 }
 
@@ -312,10 +1513,11 @@ bool setup_bench(int min_msg_size, int max_msg_size, int *num_sizes,
  * This function prints out the ASCII art logo for the benchmark suite.
  */
 void display_logo() {
-  printf("     _                   _               _   \n"
-         " ___| |_ _____ ___ _____| |_ ___ ___ ___| |_ \n"
-         "|_ -|   |     | -_|     | . | -_|   |  _|   |\n"
-         "|___|_|_|_|_|_|___|_|_|_|___|___|_|_|___|_|_|\n");
+  fprintf(report_stream(),
+          "     _                   _               _   \n"
+          " ___| |_ _____ ___ _____| |_ ___ ___ ___| |_ \n"
+          "|_ -|   |     | -_|     | . | -_|   |  _|   |\n"
+          "|___|_|_|_|_|_|___|_|_|_|___|___|_|_|___|_|_|\n");
 }
 
 /**
@@ -328,81 +1530,187 @@ void display_logo() {
  * @param shmem_name Name of the OpenSHMEM library.
  * @param shmem_version Version of the OpenSHMEM library.
  * @param npes Number of PEs (Processing Elements).
- * @param benchmark Selected benchmark
+ * @param benchmark Selected benchmarks (comma list, globs or "all")
  * @param benchtype The type of benchmark to run, either "bw", "bibw", or
- *"latency"
+ *"latency", or NULL for each benchmark's default
  * @param min_msg_size Minimum message size for test in bytes
  * @param max_msg_size Maximum message size for test in bytes
  * @param ntimes Number of times the benchmark should run
- * @param stride Stride value to use for the benchmark (only applicable to
- *certain benchmarks)
+ * @param opts Parsed runtime options (measurement modes)
  */
 void display_header(char *shmem_name, char *shmem_version, int npes,
-                    char *benchmark, char *benchtype, int min_msg_size,
-                    int max_msg_size, int ntimes, int stride) {
-  printf("\n");
-  printf("==============================================\n");
-  printf("===          Test Information              ===\n");
-  printf("==============================================\n");
-  printf("  OpenSHMEM Name:         %s\n", shmem_name);
-  printf("  OpenSHMEM Version:      %s\n", shmem_version);
-  printf("\n");
-  printf("  Number of PEs:          %d\n", npes);
-  printf("  Benchmark:              %s\n", benchmark);
-  printf("  Benchmark Type:         %s\n", benchtype);
-  if (strstr(benchmark, "atomic") == NULL &&
-      strstr(benchmark, "shmem_barrier_all") == NULL) {
-    printf("  Min Msg Size (bytes):   %d\n", min_msg_size);
-    printf("  Max Msg Size (bytes):   %d\n", max_msg_size);
-  }
-  printf("  Ntimes:                 %d\n", ntimes);
-  if (strcmp(benchmark, "shmem_iput") == 0 ||
-      strcmp(benchmark, "shmem_iget") == 0) {
-    printf("  Stride:                 %d\n", stride);
-  }
-  printf("\n");
-}
-
-/**
-  @brief Validate message size for typed operations.
-  Ensures the size is a multiple of the specified type size.
-  If size is invalid, prints error message and terminates program.
+                    char *benchmark, char *benchtype, size_t min_msg_size,
+                    size_t max_msg_size, int ntimes, const options *opts) {
+  FILE *out = report_stream();
+
+  fprintf(out, "\n");
+  fprintf(out, "==============================================\n");
+  fprintf(out, "===          Test Information              ===\n");
+  fprintf(out, "==============================================\n");
+  fprintf(out, "  OpenSHMEM Name:         %s\n", shmem_name);
+  fprintf(out, "  OpenSHMEM Version:      %s\n", shmem_version);
+  fprintf(out, "\n");
+  fprintf(out, "  Number of PEs:          %d\n", npes);
+  /* Only describe the parameters some selected benchmark actually uses */
+  int selected = 0;
+  bool sized = false, strided = false, windowed = false;
+  bool offset = false, align = false, chunked = false, traffic = false;
+  for (int i = 0; i < BENCHMARK_TABLE_SIZE; i++) {
+    if (!bench_selected(benchmark_table[i], benchmark, benchtype)) {
+      continue;
+    }
+    const bench_op_t *op;
+    for (int k = 0; (op = bench_variant(benchmark_table[i], opts->types,
+                                        k)) != NULL; k++) {
+      selected++;
+      sized |= op->sized;
+      strided |= op->uses_stride;
+      windowed |= op->complete_at == BENCH_COMPLETE_WINDOW;
+      offset |= op->uses_offset;
+      chunked |= op->uses_chunks;
+      traffic |= op->uses_traffic;
+      align |= strcmp(op->benchtype, "align") == 0;
+    }
+  }
+
+  fprintf(out, "  Benchmark:              %s\n", benchmark);
+  fprintf(out, "  Benchmark Type:         %s\n",
+          benchtype != NULL ? benchtype : "default");
+  if (opts->types != NULL) {
+    fprintf(out, "  Types:                  %s\n", opts->types);
+  }
+  fprintf(out, "  Benchmarks Selected:    %d\n", selected);
+  if (sized) {
+    char schedule[64];
+    size_schedule_describe(&bench_sizes, schedule, sizeof(schedule));
+    fprintf(out, "  Min Msg Size (bytes):   %zu\n", min_msg_size);
+    fprintf(out, "  Max Msg Size (bytes):   %zu\n", max_msg_size);
+    fprintf(out, "  Size Schedule:          %s\n", schedule);
+  }
+  if (opts->target_ci > 0.0 || opts->max_time > 0.0) {
+    fprintf(out, "  Ntimes:                 %d per batch (adaptive)\n", ntimes);
+    fprintf(out, "  Target CI (%%):          %.2f\n",
+            opts->target_ci > 0.0 ? opts->target_ci
+                                  : MEASURE_DEFAULT_TARGET_CI);
+    fprintf(out, "  Max Time (s):           %.2f\n",
+            opts->max_time > 0.0 ? opts->max_time : MEASURE_DEFAULT_MAX_TIME);
+  } else {
+    fprintf(out, "  Ntimes:                 %d\n", ntimes);
+  }
+  if (strided) {
+    fprintf(out, "  Stride:                ");
+    for (int i = 0; i < opts->num_strides; i++) {
+      fprintf(out, "%s%d", (i > 0) ? "," : " ", opts->strides[i]);
+    }
+    fprintf(out, "\n");
+  }
+  if (offset && (opts->src_offset > 0 || opts->dst_offset > 0)) {
+    fprintf(out, "  Offsets (bytes):        source %d, destination %d\n",
+            opts->src_offset, opts->dst_offset);
+  }
+  if (align) {
+    fprintf(out, "  Alignment Sweep:       ");
+    for (int i = 0; i < BENCH_ALIGN_OFFSETS; i++) {
+      fprintf(out, "%s%d", (i > 0) ? "," : " ", bench_align_offsets[i]);
+    }
+    fprintf(out, " bytes\n");
+  }
+  if (opts->pairs != PAIRS_NONE) {
+    fprintf(out, "  Pairs:                  %s\n",
+            pair_policy_name(opts->pairs));
+  }
+  if (windowed) {
+    fprintf(out, "  Window:                ");
+    for (int i = 0; i < opts->num_windows; i++) {
+      fprintf(out, "%s%d", (i > 0) ? "," : " ", opts->windows[i]);
+    }
+    fprintf(out, "\n");
+  }
+  if (opts->num_orderings > 0) {
+    fprintf(out, "  Ordering:              ");
+    for (int i = 0; i < opts->num_orderings; i++) {
+      fprintf(out, "%s%s", (i > 0) ? "," : " ",
+              ordering_name(opts->orderings[i]));
+    }
+    fprintf(out, "\n");
+  }
+  if (chunked) {
+    fprintf(out, "  Chunks:                ");
+    for (int i = 0; i < opts->num_chunks; i++) {
+      fprintf(out, "%s%d", (i > 0) ? "," : " ", opts->chunks[i]);
+    }
+    fprintf(out, "\n");
+  }
+  if (traffic) {
+    bool zipf = false;
+    fprintf(out, "  Traffic:               ");
+    for (int i = 0; i < opts->num_traffic; i++) {
+      fprintf(out, "%s%s", (i > 0) ? "," : " ",
+              traffic_name(opts->traffic[i]));
+      zipf |= opts->traffic[i] == TRAFFIC_ZIPF;
+    }
+    fprintf(out, "\n");
+    fprintf(out, "  Read:Write Ratio:       %d:%d\n", opts->traffic_reads,
+            opts->traffic_writes);
+    if (zipf) {
+      fprintf(out, "  Zipf Exponent:          %.2f\n", opts->zipf);
+    }
+  }
+  if (opts->warmup_auto) {
+    fprintf(out, "  Warmup:                 auto (steady state)\n");
+  } else {
+    fprintf(out, "  Warmup:                 %d\n", opts->warmup);
+  }
+  fprintf(out, "  Percentiles:            %s\n",
+          opts->percentiles ? "on" : "off");
+  fprintf(out, "  Per-PE Table:           %s\n", opts->pe_table ? "on" : "off");
+  fprintf(out, "  Buffers:                %s\n",
+          opts->realloc_per_size ? "reallocated per size" : "pooled");
+  if (opts->cache_cold) {
+    fprintf(out, "  Cache:                  cold (%ld-byte ring, %s)\n",
+            opts->cache_ring, cache_evict_method());
+  } else {
+    fprintf(out, "  Cache:                  warm\n");
+  }
+  fprintf(out, "\n");
+  fprintf(out, "  Timer:                  %s",
+          timer_backend_name(timer_info.backend));
+  if (timer_info.backend == TIMER_CYCLES) {
+    fprintf(out, " (%.3f GHz)", 1e-9 / timer_info.sec_per_tick);
+  }
+  fprintf(out, "\n");
+  fprintf(out, "  Timer Overhead (ns):    %.2f%s\n", timer_info.overhead_ns,
+          timer_info.subtract_overhead ? " (subtracted)" : "");
+  fprintf(out, "  Timer Resolution (ns):  %.2f\n", timer_info.resolution_ns);
+  fprintf(out, "\n");
+}
+
+/**
+  @brief Round a message size to whole elements of a typed operation.
+  Sizes below one element become one element, the others are rounded down
+  to a multiple of the element size; the first size rounded for each type
+  is noted once on PE 0.
   @param size The requested message size in bytes
   @param type_size Size of the datatype (e.g., sizeof(long))
-  @param type_name String name of the type (for error messages)
-  @return The validated message size
+  @param type_name String name of the type (for warning messages)
+  @return The message size rounded to whole elements
  */
-int validate_typed_size(int size, size_t type_size, const char *type_name) {
-  if (size < type_size) {
-    if (shmem_my_pe() == 0) {
-      fprintf(
-          stderr,
-          "ERROR: Minimum message size (%d) is less than sizeof(%s) (%ld).\n",
-          size, type_name, type_size);
-      fprintf(stderr,
-              "       Message sizes must be at least sizeof(%s) bytes.\n",
-              type_name);
-    }
-    shmem_finalize();
-    exit(EXIT_FAILURE);
-  }
+size_t validate_typed_size(size_t size, size_t type_size,
+                           const char *type_name) {
+  static const char *noted = NULL;
+  size_t rounded =
+      (size < type_size) ? type_size : size - size % type_size;
 
-  // If size is not a multiple of type_size, terminate program
-  int remainder = size % type_size;
-  if (remainder != 0) {
+  if (rounded != size && noted != type_name) {
     if (shmem_my_pe() == 0) {
-      fprintf(
-          stderr,
-          "ERROR: Message size (%d) is not a multiple of sizeof(%s) (%ld).\n",
-          size, type_name, type_size);
-      fprintf(stderr, "       Message sizes must be multiples of sizeof(%s).\n",
-              type_name);
+      fprintf(stderr,
+              "Note: Message sizes are rounded to whole %s elements "
+              "(%zu bytes), e.g. %zu to %zu.\n",
+              type_name, type_size, size, rounded);
     }
-    shmem_finalize();
-    exit(EXIT_FAILURE);
+    noted = type_name;
   }
-
-  return size;
+  return rounded;
 }
 
 /**
@@ -411,8 +1719,8 @@ int validate_typed_size(int size, size_t type_size, const char *type_name) {
   @param type_size Size of each element in bytes
   @return Number of elements
  */
-int calculate_elem_count(int byte_size, size_t type_size) {
-  int elem_count = byte_size / type_size;
+size_t calculate_elem_count(size_t byte_size, size_t type_size) {
+  size_t elem_count = byte_size / type_size;
   if (elem_count == 0)
     elem_count = 1;
   return elem_count;
@@ -0,0 +1,242 @@
+/**
+  @file sizes.c
+  @brief Message-size schedule shared by every RMA and collective sweep
+*/
+
+#include "sizes.h"
+
+/**
+  @brief qsort comparator for sizes in ascending order
+ */
+static int compare_sizes(const void *a, const void *b) {
+  size_t x = *(const size_t *)a;
+  size_t y = *(const size_t *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+  @brief Parse a size in bytes with an optional binary suffix: K, M, G or
+  T (e.g. "64K", "16G")
+  @param text Size to parse
+  @param size Set to the size in bytes
+  @param end Set to the first character after the size, or NULL to
+  require the whole of text to be the size
+  @return True if a size greater than zero was parsed without overflow
+ */
+bool size_parse(const char *text, size_t *size, const char **end) {
+  char *p;
+  if (*text < '0' || *text > '9') {
+    return false;
+  }
+  errno = 0;
+  unsigned long long value = strtoull(text, &p, 10);
+  if (errno == ERANGE) {
+    return false;
+  }
+
+  int shift = 0;
+  switch (*p) {
+  case 'K':
+  case 'k':
+    shift = 10;
+    break;
+  case 'M':
+  case 'm':
+    shift = 20;
+    break;
+  case 'G':
+  case 'g':
+    shift = 30;
+    break;
+  case 'T':
+  case 't':
+    shift = 40;
+    break;
+  }
+  if (shift > 0) {
+    p++;
+  }
+
+  if (value == 0 || value > (SIZE_MAX >> shift) ||
+      (end == NULL && *p != '\0')) {
+    return false;
+  }
+  *size = (size_t)value << shift;
+  if (end != NULL) {
+    *end = p;
+  }
+  return true;
+}
+
+/**
+  @brief Append one size to a schedule, growing the array as needed
+  @param sched Schedule to append to
+  @param capacity Current capacity of sched->sizes, updated on growth
+  @param size Size to append
+  @return True on success, false if memory ran out or the schedule already
+  holds SIZE_MAX_ROWS sizes
+ */
+static bool size_schedule_push(size_schedule_t *sched, int *capacity,
+                               size_t size) {
+  if (sched->count == SIZE_MAX_ROWS) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr,
+              "Message size schedule has more than %d sizes. Use a larger "
+              "--size-step or --size-factor.\n",
+              SIZE_MAX_ROWS);
+    }
+    return false;
+  }
+  if (sched->count == *capacity) {
+    int grown = (*capacity > 0) ? *capacity * 2 : 16;
+    size_t *sizes =
+        (size_t *)realloc(sched->sizes, grown * sizeof(size_t));
+    if (sizes == NULL) {
+      return false;
+    }
+    sched->sizes = sizes;
+    *capacity = grown;
+  }
+  sched->sizes[sched->count++] = size;
+  return true;
+}
+
+/**
+  @brief Parse an explicit comma-separated size list into a schedule
+  @param sched Schedule to fill in
+  @param list Comma-separated sizes
+  @return True on success, false if an entry is not a positive size
+ */
+static bool size_schedule_parse(size_schedule_t *sched, const char *list) {
+  int capacity = 0;
+  const char *p = list;
+
+  while (*p != '\0') {
+    const char *end;
+    size_t size;
+    if (!size_parse(p, &size, &end) || (*end != ',' && *end != '\0')) {
+      if (shmem_my_pe() == 0) {
+        fprintf(stderr, "Invalid message size list: %s\n", list);
+      }
+      return false;
+    }
+    if (!size_schedule_push(sched, &capacity, size)) {
+      return false;
+    }
+    p = (*end == ',') ? end + 1 : end;
+  }
+
+  /* Report rows in ascending order and drop repeated sizes */
+  qsort(sched->sizes, sched->count, sizeof(size_t), compare_sizes);
+  int unique = 0;
+  for (int i = 0; i < sched->count; i++) {
+    if (unique == 0 || sched->sizes[i] != sched->sizes[unique - 1]) {
+      sched->sizes[unique++] = sched->sizes[i];
+    }
+  }
+  sched->count = unique;
+  return true;
+}
+
+/**
+  @brief Generate a message-size schedule.
+  An explicit list wins over min/max; otherwise a positive step gives a
+  linear schedule and anything else a geometric one.
+  @param sched Schedule to fill in
+  @param list Comma-separated sizes (e.g. "8,24,4000,1G"), or NULL
+  @param min Smallest size for generated schedules
+  @param max Largest size for generated schedules
+  @param factor Growth factor (> 1) of a geometric schedule, or 0 for the
+  default of SIZE_DEFAULT_FACTOR
+  @param step Increment of a linear schedule, or 0 for a geometric one
+  @return True on success, false if the parameters are invalid
+ */
+bool size_schedule_build(size_schedule_t *sched, const char *list,
+                         size_t min, size_t max, double factor, size_t step) {
+  memset(sched, 0, sizeof(*sched));
+  sched->factor = (factor > 0.0) ? factor : SIZE_DEFAULT_FACTOR;
+  sched->step = step;
+
+  if (list != NULL) {
+    sched->kind = SIZE_LIST;
+    if (!size_schedule_parse(sched, list)) {
+      size_schedule_free(sched);
+      return false;
+    }
+  } else {
+    if (sched->factor <= 1.0) {
+      if (shmem_my_pe() == 0) {
+        fprintf(stderr, "Invalid size factor: %.2f. Must be > 1.\n",
+                sched->factor);
+      }
+      return false;
+    }
+
+    sched->kind = (step > 0) ? SIZE_LINEAR : SIZE_GEOMETRIC;
+    int capacity = 0;
+    size_t size = min;
+    while (size <= max) {
+      if (!size_schedule_push(sched, &capacity, size)) {
+        size_schedule_free(sched);
+        return false;
+      }
+
+      /* Stop rather than wrap around past the largest size_t */
+      size_t next;
+      if (sched->kind == SIZE_LINEAR) {
+        next = (step <= SIZE_MAX - size) ? size + step : 0;
+      } else {
+        /* Round to the nearest byte but always make progress */
+        double grown = size * sched->factor + 0.5;
+        next = (grown < (double)SIZE_MAX) ? (size_t)grown : 0;
+        next = (next > size || next == 0) ? next : size + 1;
+      }
+      if (next <= size) {
+        break;
+      }
+      size = next;
+    }
+  }
+
+  if (sched->count == 0) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr, "Message size schedule is empty.\n");
+    }
+    size_schedule_free(sched);
+    return false;
+  }
+  sched->min = sched->sizes[0];
+  sched->max = sched->sizes[sched->count - 1];
+  return true;
+}
+
+/**
+  @brief Release the sizes owned by a schedule
+  @param sched Schedule to free
+ */
+void size_schedule_free(size_schedule_t *sched) {
+  free(sched->sizes);
+  sched->sizes = NULL;
+  sched->count = 0;
+}
+
+/**
+  @brief Describe how a schedule was generated (e.g. "x2.00, 8 sizes")
+  @param sched Schedule to describe
+  @param buf Output buffer
+  @param len Size of the output buffer
+ */
+void size_schedule_describe(const size_schedule_t *sched, char *buf,
+                            size_t len) {
+  switch (sched->kind) {
+  case SIZE_LINEAR:
+    snprintf(buf, len, "+%zu, %d sizes", sched->step, sched->count);
+    break;
+  case SIZE_LIST:
+    snprintf(buf, len, "list, %d sizes", sched->count);
+    break;
+  default:
+    snprintf(buf, len, "x%.2f, %d sizes", sched->factor, sched->count);
+    break;
+  }
+}
@@ -0,0 +1,139 @@
+/**
+  @file stats.c
+  @brief Per-iteration sample storage and latency distribution statistics
+*/
+
+#include "stats.h"
+
+/**
+  @brief Allocate storage for up to capacity samples
+  @param buf Sample buffer to initialize
+  @param capacity Maximum number of samples that will be recorded
+  @return True if the allocation succeeded, false otherwise
+ */
+bool sample_buffer_init(sample_buffer_t *buf, int capacity) {
+  memset(buf, 0, sizeof(*buf));
+  if (capacity <= 0) {
+    return false;
+  }
+
+  buf->samples = (double *)malloc(capacity * sizeof(double));
+  if (buf->samples == NULL) {
+    return false;
+  }
+
+  /* Touch every slot now so the first timed iteration does not page fault */
+  memset(buf->samples, 0, capacity * sizeof(double));
+  buf->capacity = capacity;
+  return true;
+}
+
+/**
+  @brief Release the storage owned by a sample buffer
+  @param buf Sample buffer to free
+ */
+void sample_buffer_free(sample_buffer_t *buf) {
+  free(buf->samples);
+  memset(buf, 0, sizeof(*buf));
+}
+
+/**
+  @brief qsort comparator for doubles in ascending order
+ */
+static int compare_doubles(const void *a, const void *b) {
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+  @brief Return the nearest-rank percentile of a sorted array
+  @param sorted Samples sorted in ascending order
+  @param count Number of samples
+  @param pct Percentile in the range [0, 100]
+  @return The requested percentile, or 0.0 if count is 0
+ */
+double percentile_sorted(const double *sorted, int count, double pct) {
+  if (count <= 0) {
+    return 0.0;
+  }
+  int rank = (int)ceil(pct / 100.0 * count);
+  if (rank < 1) {
+    rank = 1;
+  }
+  if (rank > count) {
+    rank = count;
+  }
+  return sorted[rank - 1];
+}
+
+/**
+  @brief Compute min/percentiles/max, mean and standard deviation.
+  Sorts the recorded samples in place, so call it outside the timed region.
+  @param buf Sample buffer holding durations in seconds
+  @param stats Output statistics in microseconds
+ */
+void compute_sample_stats(sample_buffer_t *buf, sample_stats_t *stats) {
+  memset(stats, 0, sizeof(*stats));
+
+  int n = buf->count;
+  if (n == 0) {
+    return;
+  }
+
+  /* Convert to microseconds once so every statistic shares the unit */
+  double *s = buf->samples;
+  for (int i = 0; i < n; i++) {
+    s[i] *= 1e6;
+  }
+  qsort(s, n, sizeof(double), compare_doubles);
+
+  double sum = 0.0;
+  for (int i = 0; i < n; i++) {
+    sum += s[i];
+  }
+  double mean = sum / n;
+
+  double sq = 0.0;
+  for (int i = 0; i < n; i++) {
+    sq += (s[i] - mean) * (s[i] - mean);
+  }
+
+  stats->count = n;
+  stats->min = s[0];
+  stats->max = s[n - 1];
+  stats->mean = mean;
+  stats->stddev = (n > 1) ? sqrt(sq / (n - 1)) : 0.0;
+  stats->p50 = percentile_sorted(s, n, 50.0);
+  stats->p90 = percentile_sorted(s, n, 90.0);
+  stats->p99 = percentile_sorted(s, n, 99.0);
+  stats->p999 = percentile_sorted(s, n, 99.9);
+}
+
+/**
+  @brief Two-sided 95% critical value of Student's t distribution
+  @param df Degrees of freedom (at least 1)
+  @return The 0.975 quantile of t with df degrees of freedom
+ */
+double student_t_975(int df) {
+  static const double table[] = {
+      12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+      2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+      2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+  int n = sizeof(table) / sizeof(table[0]);
+
+  if (df < 1) {
+    df = 1;
+  }
+  if (df <= n) {
+    return table[df - 1];
+  }
+  /* Coarse steps towards the normal quantile are close enough past 30 */
+  if (df <= 60) {
+    return 2.000;
+  }
+  if (df <= 120) {
+    return 1.980;
+  }
+  return 1.960;
+}
@@ -0,0 +1,151 @@
+/**
+  @file timer.c
+  @brief Low-overhead timer layer with a calibrated cycle-counter backend
+*/
+
+#include <stdlib.h>
+
+#include "timer.h"
+
+/* Calibrated timer state; clock_gettime in nanoseconds until timer_init() */
+timer_info_t timer_info = {TIMER_CLOCK_GETTIME, 1e-9, 0, 0.0, 0.0, false};
+
+/**
+  @brief Check whether the cycle counter runs at a constant rate
+  @return True if the cycle counter can be used as a wall clock
+ */
+static bool timer_cycles_usable(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  /* CPUID.80000007H:EDX[8] advertises an invariant TSC */
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) {
+    return false;
+  }
+  return (edx & (1u << 8)) != 0;
+#elif defined(__aarch64__)
+  /* The generic timer counter is constant-rate by architecture */
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+  @brief Measure seconds per cycle-counter tick against CLOCK_MONOTONIC
+  @return Seconds per tick
+ */
+static double timer_calibrate_cycles(void) {
+  uint64_t ns_start = timer_read_monotonic();
+  uint64_t ticks_start = timer_read_cycles();
+  uint64_t ns_end, ticks_end;
+
+  /* Spin rather than sleep so frequency scaling settles on the busy core */
+  do {
+    ns_end = timer_read_monotonic();
+    ticks_end = timer_read_cycles();
+  } while ((ns_end - ns_start) < TIMER_CALIBRATION_SECONDS * 1e9);
+
+  return (double)(ns_end - ns_start) * 1e-9 /
+         (double)(ticks_end - ticks_start);
+}
+
+/**
+  @brief qsort comparator for uint64_t in ascending order
+ */
+static int compare_u64(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+  @brief Measure the read overhead and resolution of the selected backend
+ */
+static void timer_probe(void) {
+  uint64_t *deltas = (uint64_t *)malloc(TIMER_PROBE_READS * sizeof(uint64_t));
+  if (deltas == NULL) {
+    return;
+  }
+
+  uint64_t prev = timer_ticks();
+  for (int i = 0; i < TIMER_PROBE_READS; i++) {
+    uint64_t now = timer_ticks();
+    deltas[i] = now - prev;
+    prev = now;
+  }
+
+  qsort(deltas, TIMER_PROBE_READS, sizeof(uint64_t), compare_u64);
+
+  /* The median gap between back-to-back reads is the cost of one read */
+  double ns_per_tick = timer_info.sec_per_tick * 1e9;
+  timer_info.overhead_ns = deltas[TIMER_PROBE_READS / 2] * ns_per_tick;
+
+  /* The smallest nonzero gap is the finest step the timer can show */
+  timer_info.resolution_ns = ns_per_tick;
+  for (int i = 0; i < TIMER_PROBE_READS; i++) {
+    if (deltas[i] > 0) {
+      timer_info.resolution_ns = deltas[i] * ns_per_tick;
+      break;
+    }
+  }
+
+  free(deltas);
+}
+
+/**
+  @brief Select and calibrate the timer backend.
+  The cycle counter is calibrated against CLOCK_MONOTONIC, then the overhead
+  and resolution of the selected backend are measured.
+  @param requested Backend requested on the command line
+  @param subtract_overhead Remove the measured read overhead from
+  per-operation results
+ */
+void timer_init(timer_backend_t requested, bool subtract_overhead) {
+  timer_backend_t backend = TIMER_CLOCK_GETTIME;
+
+  if (TIMER_HAVE_CYCLE_COUNTER) {
+    if (requested == TIMER_CYCLES ||
+        (requested == TIMER_AUTO && timer_cycles_usable())) {
+      backend = TIMER_CYCLES;
+    }
+  }
+
+  if (backend == TIMER_CYCLES) {
+    timer_info.sec_per_tick = timer_calibrate_cycles();
+  } else {
+    timer_info.sec_per_tick = 1e-9;
+  }
+  timer_info.backend = backend;
+  timer_info.subtract_overhead = subtract_overhead;
+  timer_info.epoch = timer_ticks();
+
+  timer_probe();
+}
+
+/**
+  @brief Get a printable name for a timer backend
+  @param backend Backend to name
+  @return Static string naming the backend
+ */
+const char *timer_backend_name(timer_backend_t backend) {
+  switch (backend) {
+  case TIMER_CYCLES:
+#if defined(__aarch64__)
+    return "cntvct_el0";
+#else
+    return "rdtscp";
+#endif
+  case TIMER_CLOCK_GETTIME:
+    return "clock_gettime";
+  default:
+    return "auto";
+  }
+}
+
+/**
+  @brief Timer read overhead to remove from a per-operation result
+  @return Overhead in microseconds, or 0.0 if subtraction is disabled
+ */
+double timer_overhead_us(void) {
+  return timer_info.subtract_overhead ? timer_info.overhead_ns * 1e-3 : 0.0;
+}
@@ -0,0 +1,273 @@
+/**
+  @file traffic.c
+  @brief Target PE and remote offset distributions of the random-access
+  traffic benchmarks (see --traffic)
+*/
+
+#include "traffic.h"
+
+#include <math.h>
+
+/**
+  @brief Step a xorshift64 generator
+  @param state Generator state (not 0)
+  @return Next pseudo-random number
+ */
+static uint64_t traffic_random(uint64_t *state) {
+  uint64_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  *state = x;
+  return x;
+}
+
+/**
+  @brief Draw a uniform number in [0, 1)
+  @param state Generator state
+  @return Pseudo-random number
+ */
+static double traffic_uniform(uint64_t *state) {
+  return (double)(traffic_random(state) >> 11) * 0x1.0p-53;
+}
+
+/**
+  @brief Build the cumulative Zipf weights of n ranks
+  @param n Number of ranks
+  @param s Exponent; rank k has weight 1 / (k + 1)^s
+  @return n increasing weights ending at 1.0 (free()), or NULL
+ */
+static double *traffic_zipf_cdf(size_t n, double s) {
+  double *cdf = (double *)malloc(n * sizeof(double));
+  if (cdf == NULL) {
+    return NULL;
+  }
+  double sum = 0.0;
+  for (size_t k = 0; k < n; k++) {
+    sum += 1.0 / pow((double)(k + 1), s);
+    cdf[k] = sum;
+  }
+  for (size_t k = 0; k < n; k++) {
+    cdf[k] /= sum;
+  }
+  return cdf;
+}
+
+/**
+  @brief Draw a rank from cumulative Zipf weights
+  @param cdf Weights from traffic_zipf_cdf
+  @param n Number of ranks
+  @param state Generator state
+  @return Rank in [0, n)
+ */
+static size_t traffic_zipf_draw(const double *cdf, size_t n,
+                                uint64_t *state) {
+  double u = traffic_uniform(state);
+  size_t lo = 0, hi = n - 1;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (cdf[mid] > u) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+/**
+  @brief Build a random cycle through n items with Sattolo's algorithm,
+  so following it visits every item before it repeats
+  @param n Number of items
+  @param state Generator state
+  @return Successor of every item (free()), or NULL
+ */
+static size_t *traffic_cycle(size_t n, uint64_t *state) {
+  size_t *next = (size_t *)malloc(n * sizeof(size_t));
+  if (next == NULL) {
+    return NULL;
+  }
+  for (size_t i = 0; i < n; i++) {
+    next[i] = i;
+  }
+  for (size_t i = n - 1; i > 0; i--) {
+    size_t k = (size_t)(traffic_random(state) % i);
+    size_t swap = next[i];
+    next[i] = next[k];
+    next[k] = swap;
+  }
+  return next;
+}
+
+/**
+  @brief Parse the name of a traffic distribution
+  @param name "uniform", "zipf", "neighbor" or "permutation"
+  @param traffic Parsed distribution
+  @return True if the name is known, false otherwise
+ */
+bool traffic_parse(const char *name, traffic_t *traffic) {
+  if (strcmp(name, "uniform") == 0) {
+    *traffic = TRAFFIC_UNIFORM;
+  } else if (strcmp(name, "zipf") == 0) {
+    *traffic = TRAFFIC_ZIPF;
+  } else if (strcmp(name, "neighbor") == 0) {
+    *traffic = TRAFFIC_NEIGHBOR;
+  } else if (strcmp(name, "permutation") == 0) {
+    *traffic = TRAFFIC_PERMUTATION;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+  @brief Parse a comma-separated list of traffic distributions
+  @param arg List to parse, e.g. "uniform,zipf"
+  @param traffic Parsed distributions
+  @param max Most distributions the list may hold
+  @param count Number of distributions parsed
+  @return True if every name is known and the list is not too long
+ */
+bool traffic_parse_list(const char *arg, traffic_t *traffic, int max,
+                        int *count) {
+  char name[32];
+  *count = 0;
+  const char *p = arg;
+  while (*p != '\0') {
+    size_t len = strcspn(p, ",");
+    if (len == 0 || len >= sizeof(name) || *count == max) {
+      return false;
+    }
+    memcpy(name, p, len);
+    name[len] = '\0';
+    if (!traffic_parse(name, &traffic[*count])) {
+      return false;
+    }
+    (*count)++;
+    p += (p[len] == ',') ? len + 1 : len;
+  }
+  return *count > 0;
+}
+
+/**
+  @brief Parse a read:write ratio
+  @param arg Ratio to parse, e.g. "3:1" (reads first)
+  @param reads Parsed reads
+  @param writes Parsed writes
+  @return True if both are counts >= 0 and not both 0
+ */
+bool traffic_parse_ratio(const char *arg, int *reads, int *writes) {
+  char *end;
+  long r = strtol(arg, &end, 10);
+  if (end == arg || *end != ':') {
+    return false;
+  }
+  const char *w_arg = end + 1;
+  long w = strtol(w_arg, &end, 10);
+  if (end == w_arg || *end != '\0' || r < 0 || w < 0 || r + w == 0 ||
+      r > 1000000 || w > 1000000) {
+    return false;
+  }
+  *reads = (int)r;
+  *writes = (int)w;
+  return true;
+}
+
+/**
+  @brief Get the name of a traffic distribution
+  @param traffic Traffic distribution
+  @return Name as accepted by --traffic
+ */
+const char *traffic_name(traffic_t traffic) {
+  switch (traffic) {
+  case TRAFFIC_ZIPF:
+    return "zipf";
+  case TRAFFIC_NEIGHBOR:
+    return "neighbor";
+  case TRAFFIC_PERMUTATION:
+    return "permutation";
+  default:
+    return "uniform";
+  }
+}
+
+/**
+  @brief Precompute the accesses of one PE, so no random number is drawn
+  in the timed loop. Exactly count * writes / (reads + writes) of them
+  (rounded down) are writes, shuffled among the reads.
+  @param accesses Filled with count accesses
+  @param count Number of accesses
+  @param traffic Distribution of the target PEs and slots
+  @param zipf Exponent s of TRAFFIC_ZIPF
+  @param reads Reads of the read:write ratio
+  @param writes Writes of the read:write ratio
+  @param mype This PE
+  @param npes Number of PEs
+  @param slots Slots of the region on every PE
+  @param slot_bytes Bytes from one slot to the next
+  @return True on success, false if memory ran out
+ */
+bool traffic_generate(traffic_access_t *accesses, int count,
+                      traffic_t traffic, double zipf, int reads, int writes,
+                      int mype, int npes, size_t slots, size_t slot_bytes) {
+  /* Every PE draws its own accesses; the PE cycle of the permutation is
+     drawn from one seed so all PEs agree on it */
+  uint64_t state = 0x9e3779b97f4a7c15ULL * (uint64_t)(mype + 1);
+  uint64_t shared = 0x2545f4914f6cdd1dULL;
+  double *pe_cdf = NULL, *slot_cdf = NULL;
+  size_t *pe_cycle = NULL, *slot_cycle = NULL;
+  bool ok = true;
+
+  if (traffic == TRAFFIC_ZIPF) {
+    pe_cdf = traffic_zipf_cdf((size_t)npes, zipf);
+    slot_cdf = traffic_zipf_cdf(slots, zipf);
+    ok = pe_cdf != NULL && slot_cdf != NULL;
+  } else if (traffic == TRAFFIC_PERMUTATION) {
+    pe_cycle = traffic_cycle((size_t)npes, &shared);
+    slot_cycle = traffic_cycle(slots, &state);
+    ok = pe_cycle != NULL && slot_cycle != NULL;
+  }
+
+  size_t slot = 0;
+  for (int j = 0; ok && j < count; j++) {
+    traffic_access_t *a = &accesses[j];
+    switch (traffic) {
+    case TRAFFIC_ZIPF:
+      a->pe = (int)traffic_zipf_draw(pe_cdf, (size_t)npes, &state);
+      slot = traffic_zipf_draw(slot_cdf, slots, &state);
+      break;
+    case TRAFFIC_NEIGHBOR:
+      a->pe = (mype + ((j & 1) ? npes - 1 : 1)) % npes;
+      slot = (size_t)(j / 2) % slots;
+      break;
+    case TRAFFIC_PERMUTATION:
+      a->pe = (int)pe_cycle[mype];
+      slot = (j == 0) ? 0 : slot_cycle[slot];
+      break;
+    default:
+      a->pe = (int)(traffic_random(&state) % (uint64_t)npes);
+      slot = (size_t)(traffic_random(&state) % slots);
+      break;
+    }
+    a->offset = slot * slot_bytes;
+    a->write = false;
+  }
+
+  /* The writes of the ratio, shuffled among the reads */
+  int num_writes = (int)((long)count * writes / (reads + writes));
+  for (int j = 0; ok && j < num_writes; j++) {
+    accesses[j].write = true;
+  }
+  for (int j = count - 1; ok && j > 0; j--) {
+    int k = (int)(traffic_random(&state) % (uint64_t)(j + 1));
+    bool swap = accesses[j].write;
+    accesses[j].write = accesses[k].write;
+    accesses[k].write = swap;
+  }
+
+  free(pe_cdf);
+  free(slot_cdf);
+  free(pe_cycle);
+  free(slot_cycle);
+  return ok;
+}